@@ -0,0 +1,135 @@
+/**
+ * Shared helpers for the benchmark suites
+ *
+ * Every suite receives a context with a shared Application and a hidden Webview
+ * that has finished loading, and returns a plain JSON-serializable result object.
+ */
+
+import { performance } from "node:perf_hooks";
+import { Application, Webview, SmartviewRPC } from "../index.js";
+
+export const sleep = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+
+/**
+ * Summarize a list of millisecond samples
+ * @param {number[]} samples
+ */
+export function summarize(samples) {
+  if (samples.length === 0) {
+    return { count: 0, mean: 0, min: 0, max: 0, p50: 0, p90: 0, p99: 0 };
+  }
+
+  const sorted = [...samples].sort((a, b) => a - b);
+  const pick = (q) => sorted[Math.min(sorted.length - 1, Math.ceil(q * sorted.length) - 1)];
+  const sum = sorted.reduce((total, value) => total + value, 0);
+
+  return {
+    count: sorted.length,
+    mean: round(sum / sorted.length),
+    min: round(sorted[0]),
+    max: round(sorted[sorted.length - 1]),
+    p50: round(pick(0.5)),
+    p90: round(pick(0.9)),
+    p99: round(pick(0.99)),
+  };
+}
+
+export function round(value, digits = 4) {
+  const scale = 10 ** digits;
+  return Math.round(value * scale) / scale;
+}
+
+/**
+ * Time `iterations` sequential awaits of `fn` after `warmup` untimed runs
+ * @returns {Promise<number[]>} per-iteration latency in ms
+ */
+export async function measureLatency(fn, { iterations, warmup = 10 }) {
+  for (let i = 0; i < warmup; i++) {
+    await fn(i);
+  }
+
+  const samples = new Array(iterations);
+  for (let i = 0; i < iterations; i++) {
+    const start = performance.now();
+    await fn(i);
+    samples[i] = performance.now() - start;
+  }
+  return samples;
+}
+
+/**
+ * Run `count` operations with at most `concurrency` in flight and report ops/sec
+ */
+export async function measureThroughput(fn, { count, concurrency = 32 }) {
+  let next = 0;
+  const start = performance.now();
+
+  const worker = async () => {
+    while (next < count) {
+      await fn(next++);
+    }
+  };
+
+  await Promise.all(Array.from({ length: Math.min(concurrency, count) }, worker));
+
+  const elapsed = performance.now() - start;
+  return { count, elapsedMs: round(elapsed), opsPerSec: round((count / elapsed) * 1000, 1) };
+}
+
+/**
+ * Resolve once `predicate()` is true, polling on the Node loop
+ */
+export async function waitFor(predicate, { timeout = 10000, interval = 5 } = {}) {
+  const deadline = performance.now() + timeout;
+  while (!predicate()) {
+    if (performance.now() > deadline) {
+      throw new Error("Timed out waiting for benchmark condition");
+    }
+    await sleep(interval);
+  }
+}
+
+/**
+ * Create the application and a hidden webview shared by all suites
+ */
+export async function createContext() {
+  // Custom schemes must be registered before the application is initialized
+  SmartviewRPC.registerScheme();
+  Webview.registerScheme("bench");
+
+  const app = Application.init({ id: "saucer-nodejs-bench" });
+  const webview = new Webview(app, { hardwareAcceleration: false });
+
+  // Suites add routes to serve their own payloads from the bench:// origin
+  const routes = new Map();
+  routes.set("/", () => ({
+    data: '<!doctype html><html><head><meta charset="utf-8"></head><body>bench</body></html>',
+    mime: "text/html",
+    status: 200,
+  }));
+
+  webview.handleScheme(
+    "bench",
+    async (request) => {
+      const route = routes.get(new URL(request.url).pathname);
+      if (!route) {
+        return { data: "not found", mime: "text/plain", status: 404 };
+      }
+      return route(request);
+    },
+    "async",
+  );
+
+  const ready = new Promise((resolve) => webview.once("dom-ready", resolve));
+  webview.size = { width: 800, height: 600 };
+  webview.navigate("bench://index/");
+  await ready;
+
+  const reload = async () => {
+    const loaded = new Promise((resolve) => webview.once("dom-ready", resolve));
+    webview.navigate("bench://index/");
+    await loaded;
+  };
+
+  return { app, webview, routes, reload };
+}
@@ -0,0 +1,136 @@
+#!/usr/bin/env node
+/**
+ * saucer-nodejs benchmark runner
+ *
+ * Usage:
+ *   node bench/run.js [suite...] [--out results.json] [--scale 0.25] [--list]
+ *
+ * On headless Linux run it under Xvfb:
+ *   xvfb-run -a node bench/run.js --out results.json
+ *
+ * Results are written as JSON (to stdout unless --out is given); progress goes to stderr.
+ */
+
+import { readFileSync, writeFileSync } from "node:fs";
+import os from "node:os";
+import { createContext } from "./harness.js";
+
+import * as rpc from "./suites/rpc.js";
+import * as rpcCalls from "./suites/rpc-calls.js";
+import * as evaluate from "./suites/evaluate.js";
+import * as message from "./suites/message.js";
+import * as scheme from "./suites/scheme.js";
+import * as loop from "./suites/loop.js";
+import * as events from "./suites/events.js";
+import * as idle from "./suites/idle.js";
+
+// Idle runs last so the other suites' work has drained
+const SUITES = { rpc, "rpc-calls": rpcCalls, evaluate, message, scheme, loop, events, idle };
+
+const RESULT_SCHEMA = 1;
+
+function parseArgs(argv) {
+  const options = { suites: [], out: null, scale: 1, list: false };
+
+  for (let i = 0; i < argv.length; i++) {
+    const arg = argv[i];
+    if (arg === "--out") {
+      options.out = argv[++i];
+    } else if (arg.startsWith("--out=")) {
+      options.out = arg.slice("--out=".length);
+    } else if (arg === "--scale") {
+      options.scale = Number(argv[++i]);
+    } else if (arg.startsWith("--scale=")) {
+      options.scale = Number(arg.slice("--scale=".length));
+    } else if (arg === "--list") {
+      options.list = true;
+    } else if (arg.startsWith("--")) {
+      throw new Error(`Unknown option: ${arg}`);
+    } else {
+      options.suites.push(arg);
+    }
+  }
+
+  if (!Number.isFinite(options.scale) || options.scale <= 0) {
+    throw new Error("--scale must be a positive number");
+  }
+
+  for (const name of options.suites) {
+    if (!SUITES[name]) {
+      throw new Error(`Unknown suite '${name}' (available: ${Object.keys(SUITES).join(", ")})`);
+    }
+  }
+
+  return options;
+}
+
+function environment() {
+  const pkg = JSON.parse(readFileSync(new URL("../package.json", import.meta.url), "utf8"));
+  const cpus = os.cpus();
+
+  return {
+    package: pkg.name,
+    version: pkg.version,
+    node: process.version,
+    platform: process.platform,
+    arch: process.arch,
+    cpu: cpus.length > 0 ? cpus[0].model : null,
+    cpuCount: cpus.length,
+    totalMemory: os.totalmem(),
+    display: process.env.DISPLAY ?? process.env.WAYLAND_DISPLAY ?? null,
+  };
+}
+
+async function main() {
+  const options = parseArgs(process.argv.slice(2));
+
+  if (options.list) {
+    for (const [name, suite] of Object.entries(SUITES)) {
+      console.log(`${name.padEnd(10)} ${suite.description}`);
+    }
+    return;
+  }
+
+  const selected = options.suites.length > 0 ? options.suites : Object.keys(SUITES);
+  const context = await createContext();
+
+  const report = {
+    schema: RESULT_SCHEMA,
+    timestamp: new Date().toISOString(),
+    environment: environment(),
+    scale: options.scale,
+    suites: {},
+    metrics: null,
+  };
+
+  let failed = false;
+  for (const name of selected) {
+    process.stderr.write(`[bench] ${name}: ${SUITES[name].description}\n`);
+    try {
+      report.suites[name] = await SUITES[name].run(context, { scale: options.scale });
+    } catch (error) {
+      failed = true;
+      report.suites[name] = { error: error?.message ?? String(error) };
+      process.stderr.write(`[bench] ${name} failed: ${report.suites[name].error}\n`);
+    }
+  }
+
+  report.metrics = context.app.metrics();
+
+  const json = JSON.stringify(report, null, 2);
+  if (options.out) {
+    writeFileSync(options.out, json + "\n");
+    process.stderr.write(`[bench] wrote ${options.out}\n`);
+  } else {
+    process.stdout.write(json + "\n");
+  }
+
+  context.webview.close();
+  context.app.quit();
+  process.exit(failed ? 1 : 0);
+}
+
+main().catch((error) => {
+  console.error("[bench]", error);
+  process.exit(1);
+});
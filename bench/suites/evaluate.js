@@ -0,0 +1,20 @@
+/**
+ * evaluate() latency (sequential) and throughput (pipelined)
+ */
+
+import { measureLatency, measureThroughput, summarize } from "../harness.js";
+
+export const description = "webview.evaluate() latency and throughput";
+
+export async function run({ webview }, { scale }) {
+  const iterations = Math.max(50, Math.round(1000 * scale));
+
+  const latency = await measureLatency(() => webview.evaluate("1 + 1"), { iterations });
+
+  const throughput = await measureThroughput(() => webview.evaluate("1 + 1"), {
+    count: iterations * 2,
+    concurrency: 64,
+  });
+
+  return { latencyMs: summarize(latency), throughput };
+}
@@ -0,0 +1,47 @@
+/**
+ * Event emit rate: the page changes document.title in a loop and Node counts
+ * "title" events, with one and with several listeners attached
+ */
+
+import { performance } from "node:perf_hooks";
+import { round, sleep, waitFor } from "../harness.js";
+
+export const description = "webview event emit rate (title events)";
+
+export async function run({ webview }, { scale }) {
+  const count = Math.max(200, Math.round(2000 * scale));
+  const results = {};
+
+  for (const listeners of [1, 8]) {
+    let received = 0;
+    const callbacks = Array.from({ length: listeners }, (_, index) =>
+      index === 0 ? () => received++ : () => {},
+    );
+    callbacks.forEach((callback) => webview.on("title", callback));
+
+    const start = performance.now();
+    webview.execute(`(() => {
+      for (let i = 0; i < ${count}; i++) document.title = "bench-${listeners}-" + i;
+    })()`);
+
+    // The engine may coalesce title changes; report what actually arrived
+    try {
+      await waitFor(() => received >= count, { timeout: 5000, interval: 1 });
+    } catch {
+      // Fall through with a partial count
+    }
+    const elapsed = performance.now() - start;
+    await sleep(50);
+
+    callbacks.forEach((callback) => webview.off("title", callback));
+
+    results[`${listeners}listener${listeners === 1 ? "" : "s"}`] = {
+      sent: count,
+      received,
+      elapsedMs: round(elapsed),
+      eventsPerSec: round((received / elapsed) * 1000, 1),
+    };
+  }
+
+  return results;
+}
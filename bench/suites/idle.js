@@ -0,0 +1,33 @@
+/**
+ * Idle CPU of the integrated event loop with a loaded, idle webview
+ */
+
+import { performance } from "node:perf_hooks";
+import { round, sleep } from "../harness.js";
+
+export const description = "process CPU while the event loop is idle";
+
+export async function run({ app }, { scale }) {
+  const duration = Math.max(1000, Math.round(5000 * scale));
+
+  const before = app.metrics();
+  const usage = process.cpuUsage();
+  const start = performance.now();
+
+  await sleep(duration);
+
+  const elapsed = performance.now() - start;
+  const cpu = process.cpuUsage(usage);
+  const after = app.metrics();
+
+  const iterations = after.loop.iterations - before.loop.iterations;
+
+  return {
+    durationMs: round(elapsed),
+    userMs: round(cpu.user / 1000),
+    systemMs: round(cpu.system / 1000),
+    cpuPercent: round(((cpu.user + cpu.system) / 1000 / elapsed) * 100, 3),
+    loopIterations: iterations,
+    loopIterationsPerSec: round((iterations / elapsed) * 1000, 1),
+  };
+}
@@ -0,0 +1,42 @@
+/**
+ * post() and dispatch() latency from the Node side to the UI thread and back
+ */
+
+import { performance } from "node:perf_hooks";
+import { measureLatency, round, summarize } from "../harness.js";
+
+export const description = "app.post() / app.dispatch() latency";
+
+export async function run({ app }, { scale }) {
+  const iterations = Math.max(100, Math.round(2000 * scale));
+
+  const post = await measureLatency(
+    () => new Promise((resolve) => app.post(resolve)),
+    { iterations },
+  );
+
+  const dispatch = await measureLatency(() => app.dispatch(() => 1), { iterations });
+
+  // Burst: queue everything at once and time until the last post runs
+  const burst = Math.max(1000, Math.round(20000 * scale));
+  const start = performance.now();
+  await new Promise((resolve) => {
+    let remaining = burst;
+    for (let i = 0; i < burst; i++) {
+      app.post(() => {
+        if (--remaining === 0) resolve();
+      });
+    }
+  });
+  const elapsed = performance.now() - start;
+
+  return {
+    postLatencyMs: summarize(post),
+    dispatchLatencyMs: summarize(dispatch),
+    postBurst: {
+      count: burst,
+      elapsedMs: round(elapsed),
+      postsPerSec: round((burst / elapsed) * 1000, 1),
+    },
+  };
+}
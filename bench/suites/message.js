@@ -0,0 +1,44 @@
+/**
+ * onMessage throughput: the page fires send_message in a loop and Node counts arrivals
+ */
+
+import { performance } from "node:perf_hooks";
+import { round, waitFor } from "../harness.js";
+
+export const description = "page -> Node onMessage throughput";
+
+export async function run({ webview }, { scale }) {
+  const count = Math.max(500, Math.round(10000 * scale));
+
+  let received = 0;
+  let bytes = 0;
+  webview.onMessage((message) => {
+    received++;
+    bytes += message.length;
+  });
+
+  const start = performance.now();
+  webview.execute(`(() => {
+    const message = JSON.stringify({ type: "bench", seq: 0, payload: "x".repeat(64) });
+    for (let i = 0; i < ${count}; i++) window.saucer.internal.send_message(message);
+  })()`);
+
+  let timedOut = false;
+  try {
+    await waitFor(() => received >= count, { timeout: 30000, interval: 1 });
+  } catch {
+    timedOut = true;
+  }
+
+  const elapsed = performance.now() - start;
+  webview.onMessage(() => {});
+
+  return {
+    sent: count,
+    received,
+    timedOut,
+    elapsedMs: round(elapsed),
+    messagesPerSec: round((received / elapsed) * 1000, 1),
+    megabytesPerSec: round(bytes / 1048576 / (elapsed / 1000), 3),
+  };
+}
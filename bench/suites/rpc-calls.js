@@ -0,0 +1,63 @@
+/**
+ * Small-payload expose() call overhead
+ *
+ * Measures per-call cost where serialization is negligible, for sync and promise-returning
+ * handlers and with many calls in flight. `poolGrowth` is how many pooled call records were
+ * allocated during the timed phase; after warmup it should stay at 0.
+ */
+
+import { round, summarize } from "../harness.js";
+
+export const description = "expose() small-call overhead and call-record pool growth";
+
+const CONCURRENCY = 32;
+
+export async function run({ app, webview }, { scale }) {
+  webview.expose("benchSync", (value) => value + 1);
+  webview.expose("benchAsync", async (value) => value + 1);
+
+  const iterations = Math.max(200, Math.round(5000 * scale));
+  const records = () => app.metrics().rpcPool.records;
+
+  const measure = async (name) => {
+    // Warm up with the same concurrency so the pool reaches its peak size first
+    await webview.evaluate(`Promise.all(Array.from({ length: ${CONCURRENCY} }, (_, i) => window.saucer.exposed.${name}(i)))`);
+    const before = records();
+
+    const sequential = await webview.evaluate(`(async () => {
+      const samples = [];
+      for (let i = 0; i < ${iterations}; i++) {
+        const start = performance.now();
+        await window.saucer.exposed.${name}(i);
+        samples.push(performance.now() - start);
+      }
+      return samples;
+    })()`);
+
+    const burst = await webview.evaluate(`(async () => {
+      const start = performance.now();
+      for (let i = 0; i < ${iterations}; i += ${CONCURRENCY}) {
+        await Promise.all(Array.from({ length: ${CONCURRENCY} }, (_, j) => window.saucer.exposed.${name}(i + j)));
+      }
+      return performance.now() - start;
+    })()`);
+
+    return {
+      latencyMs: summarize(sequential),
+      concurrentCallsPerSec: round((iterations / burst) * 1000, 1),
+      poolGrowth: records() - before,
+    };
+  };
+
+  const result = {
+    iterations,
+    concurrency: CONCURRENCY,
+    sync: await measure("benchSync"),
+    async: await measure("benchAsync"),
+    poolRecords: records(),
+  };
+
+  webview.clearExposed("benchSync");
+  webview.clearExposed("benchAsync");
+  return result;
+}
@@ -0,0 +1,39 @@
+/**
+ * Expose RPC round-trip latency by payload size
+ *
+ * The page calls window.saucer.exposed.benchEcho in a tight loop and times each
+ * call with its own clock, so the numbers exclude the evaluate() hop that starts it.
+ */
+
+import { summarize } from "../harness.js";
+
+export const description = "expose() RPC round-trip latency by payload size";
+
+const SIZES = [16, 1024, 16 * 1024, 256 * 1024];
+
+export async function run({ webview }, { scale }) {
+  webview.expose("benchEcho", (value) => value);
+
+  const results = {};
+  for (const size of SIZES) {
+    const iterations = Math.max(20, Math.round((size >= 65536 ? 100 : 500) * scale));
+
+    const samples = await webview.evaluate(`(async () => {
+      const payload = "x".repeat(${size});
+      for (let i = 0; i < 10; i++) await window.saucer.exposed.benchEcho(payload);
+      const samples = [];
+      for (let i = 0; i < ${iterations}; i++) {
+        const start = performance.now();
+        const echoed = await window.saucer.exposed.benchEcho(payload);
+        samples.push(performance.now() - start);
+        if (echoed.length !== payload.length) throw new Error("payload mismatch");
+      }
+      return samples;
+    })()`);
+
+    results[`${size}B`] = { bytes: size, latencyMs: summarize(samples) };
+  }
+
+  webview.clearExposed("benchEcho");
+  return results;
+}
@@ -0,0 +1,70 @@
+/**
+ * Scheme request throughput: JSON over a custom scheme vs binary via SmartviewRPC
+ *
+ * Both paths go through handleScheme(); the JSON path encodes the payload as a
+ * JSON document, the binary path posts raw bytes to saucer-rpc:// with callBinary().
+ */
+
+import { createRPC } from "../../index.js";
+import { round } from "../harness.js";
+
+export const description = "custom scheme throughput, JSON vs binary (SmartviewRPC)";
+
+const SIZES = [1024, 64 * 1024, 1024 * 1024];
+
+export async function run({ webview, routes, reload }, { scale }) {
+  routes.set("/json", (request) => ({
+    data: JSON.stringify({ echo: JSON.parse(request.content.toString("utf8")).data }),
+    mime: "application/json",
+    status: 200,
+  }));
+
+  const rpc = createRPC(webview);
+  rpc.define("benchBinary", { params: [{ name: "data", binary: true }], returns: "Buffer" }, (data) => data);
+
+  // The callBinary helper is injected on the next page load
+  await reload();
+
+  const results = { json: {}, binary: {} };
+  for (const size of SIZES) {
+    const count = Math.max(10, Math.round((size >= 1048576 ? 50 : 500) * scale));
+
+    const json = await webview.evaluate(`(async () => {
+      const body = JSON.stringify({ data: "x".repeat(${size}) });
+      const start = performance.now();
+      for (let i = 0; i < ${count}; i++) {
+        const response = await fetch("bench://index/json", { method: "POST", body });
+        const parsed = await response.json();
+        if (parsed.echo.length !== ${size}) throw new Error("payload mismatch");
+      }
+      return performance.now() - start;
+    })()`);
+
+    const binary = await webview.evaluate(`(async () => {
+      const body = new Uint8Array(${size}).fill(120);
+      const start = performance.now();
+      for (let i = 0; i < ${count}; i++) {
+        const echoed = await window.saucer.callBinary("benchBinary", body);
+        if (echoed.byteLength !== ${size}) throw new Error("payload mismatch");
+      }
+      return performance.now() - start;
+    })()`);
+
+    results.json[`${size}B`] = rate(size, count, json);
+    results.binary[`${size}B`] = rate(size, count, binary);
+  }
+
+  rpc.undefine("benchBinary");
+  routes.delete("/json");
+  return results;
+}
+
+function rate(size, count, elapsed) {
+  return {
+    bytes: size,
+    requests: count,
+    elapsedMs: round(elapsed),
+    requestsPerSec: round((count / elapsed) * 1000, 1),
+    megabytesPerSec: round((size * count * 2) / 1048576 / (elapsed / 1000), 3),
+  };
+}
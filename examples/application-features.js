@@ -1,5 +1,6 @@
-import { Application, Webview, Icon, Stash, Desktop, PDF, SmartviewRPC, createRPC, Types, clipboard, Notification, SystemTray } from "../index.js";
+import { Application, Webview, Icon, Stash, Desktop, PDF, RenderPool, WebviewPool, SmartviewRPC, createRPC, Types, clipboard, Notification, SystemTray } from "../index.js";
 import * as readline from "readline";
+import { spawn } from "child_process";
 
 // Register custom URL schemes BEFORE any Application/Webview initialization
 // This is required for custom scheme handlers to work
@@ -55,15 +56,28 @@ const API_PARITY_MANIFEST = {
       ctor: Application,
       staticMethods: ["active", "init"],
       methods: [
+        "cancel",
+        "cancelIdle",
+        "createWebviewPool",
         "dispatch",
+        "getStartupTimeline",
         "isThreadSafe",
         "make",
+        "metrics",
         "nativeHandle",
+        "off",
+        "on",
         "poolEmplace",
         "poolSubmit",
         "post",
         "quit",
+        "requestIdle",
         "run",
+        "startStallWatchdog",
+        "startTracing",
+        "step",
+        "stopStallWatchdog",
+        "stopTracing",
       ],
       accessors: ["native"],
     },
@@ -71,6 +85,7 @@ const API_PARITY_MANIFEST = {
       ctor: Webview,
       staticMethods: ["registerScheme"],
       methods: [
+        "apply",
         "back",
         "clearEmbedded",
         "clearExposed",
@@ -82,6 +97,7 @@ const API_PARITY_MANIFEST = {
         "expose",
         "focus",
         "forward",
+        "getGeometry",
         "handleScheme",
         "hide",
         "inject",
@@ -129,7 +145,7 @@ const API_PARITY_MANIFEST = {
     },
     Stash: {
       ctor: Stash,
-      staticMethods: ["from", "view"],
+      staticMethods: ["from", "sharedStats", "view"],
       methods: ["getData"],
       accessors: ["native", "size"],
     },
@@ -142,15 +158,37 @@ const API_PARITY_MANIFEST = {
     Desktop: {
       ctor: Desktop,
       staticMethods: [],
-      methods: ["open", "pickFile", "pickFiles", "pickFolder", "pickFolders"],
+      methods: [
+        "open",
+        "pickFile",
+        "pickFileAsync",
+        "pickFiles",
+        "pickFilesAsync",
+        "pickFolder",
+        "pickFolderAsync",
+        "pickFolders",
+        "pickFoldersAsync",
+      ],
       accessors: ["native"],
     },
     PDF: {
       ctor: PDF,
       staticMethods: [],
-      methods: ["save"],
+      methods: ["save", "saveAsync"],
       accessors: ["native"],
     },
+    RenderPool: {
+      ctor: RenderPool,
+      staticMethods: [],
+      methods: ["close", "render", "renderAll"],
+      accessors: ["stats"],
+    },
+    WebviewPool: {
+      ctor: WebviewPool,
+      staticMethods: [],
+      methods: ["acquire", "close"],
+      accessors: ["stats"],
+    },
     SmartviewRPC: {
       ctor: SmartviewRPC,
       staticMethods: ["isSchemeRegistered", "registerScheme"],
@@ -184,7 +222,7 @@ const API_PARITY_MANIFEST = {
       "uint8",
       "void",
     ],
-    clipboard: ["clear", "hasImage", "hasText", "readText", "writeText"],
+    clipboard: ["clear", "hasImage", "hasText", "readImageAsync", "readText", "readTextAsync", "writeText"],
   },
 };
 
@@ -570,6 +608,328 @@ process.on("unhandledRejection", (reason, promise) => {
   testResults.errors.push({ type: "unhandledRejection", reason, promise });
 });
 
+// Child-process helpers: some behavior (a private D-Bus, loop modes) needs its own process
+const INDEX_URL = new URL("../index.js", import.meta.url).href;
+
+function runChild(command, args, { env = process.env, timeoutMs = 15000 } = {}) {
+  return new Promise((resolve, reject) => {
+    const child = spawn(command, args, { env, stdio: ["ignore", "pipe", "pipe"] });
+    let stdout = "";
+    let stderr = "";
+
+    const timer = setTimeout(() => {
+      child.kill("SIGKILL");
+      reject(new Error(`${command} timed out after ${timeoutMs}ms`));
+    }, timeoutMs);
+
+    child.stdout.on("data", (chunk) => (stdout += chunk));
+    child.stderr.on("data", (chunk) => (stderr += chunk));
+    child.on("error", (error) => {
+      clearTimeout(timer);
+      reject(error);
+    });
+    child.on("close", (code) => {
+      clearTimeout(timer);
+      resolve({ code, stdout, stderr });
+    });
+  });
+}
+
+// Starts a long-running helper and resolves with its first stdout line
+function startHelper(command, args, env) {
+  return new Promise((resolve, reject) => {
+    const child = spawn(command, args, { env, stdio: ["ignore", "pipe", "inherit"] });
+    const lines = [];
+    let buffered = "";
+    let started = false;
+
+    const timer = setTimeout(() => {
+      child.kill("SIGKILL");
+      reject(new Error(`${command} did not start`));
+    }, 5000);
+
+    child.stdout.on("data", (chunk) => {
+      buffered += chunk;
+      let newline;
+      while ((newline = buffered.indexOf("\n")) >= 0) {
+        const line = buffered.slice(0, newline);
+        buffered = buffered.slice(newline + 1);
+        if (!started) {
+          started = true;
+          clearTimeout(timer);
+          resolve({ child, first: line.trim(), lines });
+        } else {
+          lines.push(line);
+        }
+      }
+    });
+    child.on("error", (error) => {
+      clearTimeout(timer);
+      reject(error);
+    });
+    child.on("exit", (code) => {
+      clearTimeout(timer);
+      if (!started) reject(new Error(`${command} exited with ${code}`));
+    });
+  });
+}
+
+// Minimal org.freedesktop.Notifications server. Logs each Notify as a JSON line; notifications titled
+// "click-me..." are clicked (ActionInvoked "default") and then dismissed (NotificationClosed reason 2)
+const MOCK_NOTIFICATION_SERVER = `
+import json, time
+from gi.repository import Gio, GLib
+
+NAME = "org.freedesktop.Notifications"
+PATH = "/org/freedesktop/Notifications"
+XML = """<node><interface name="org.freedesktop.Notifications">
+  <method name="Notify">
+    <arg type="s" direction="in"/><arg type="u" direction="in"/><arg type="s" direction="in"/>
+    <arg type="s" direction="in"/><arg type="s" direction="in"/><arg type="as" direction="in"/>
+    <arg type="a{sv}" direction="in"/><arg type="i" direction="in"/><arg type="u" direction="out"/>
+  </method>
+  <method name="GetServerInformation">
+    <arg type="s" direction="out"/><arg type="s" direction="out"/><arg type="s" direction="out"/><arg type="s" direction="out"/>
+  </method>
+  <signal name="ActionInvoked"><arg type="u"/><arg type="s"/></signal>
+  <signal name="NotificationClosed"><arg type="u"/><arg type="u"/></signal>
+</interface></node>"""
+
+counter = [0]
+
+def on_call(conn, sender, path, iface, method, params, invocation):
+    if method == "GetServerInformation":
+        invocation.return_value(GLib.Variant("(ssss)", ("mock", "saucer", "1", "1.2")))
+        return
+
+    _, replaces, _, title, body, _, _, _ = params.unpack()
+    if replaces == 0:
+        counter[0] += 1
+        replaces = counter[0]
+    nid = replaces
+
+    print(json.dumps({"t": time.monotonic() * 1000, "id": nid, "title": title, "body": body}), flush=True)
+    invocation.return_value(GLib.Variant("(u)", (nid,)))
+
+    if title.startswith("click-me"):
+        def fire():
+            conn.emit_signal(None, PATH, NAME, "ActionInvoked", GLib.Variant("(us)", (nid, "default")))
+            conn.emit_signal(None, PATH, NAME, "NotificationClosed", GLib.Variant("(uu)", (nid, 2)))
+            return False
+        GLib.timeout_add(50, fire)
+
+bus = Gio.bus_get_sync(Gio.BusType.SESSION, None)
+bus.register_object(PATH, Gio.DBusNodeInfo.new_for_xml(XML).interfaces[0], on_call, None, None)
+Gio.bus_own_name_on_connection(bus, NAME, Gio.BusNameOwnerFlags.NONE,
+    lambda *_: print(json.dumps({"ready": True}), flush=True), None)
+GLib.MainLoop().run()
+`;
+
+// Runs in a child with the private bus: a burst of distinct notifications, a flood of updates to one
+// notification, and one that the mock clicks and closes
+const NOTIFICATION_CHILD = `
+import { Application, Notification } from ${JSON.stringify(INDEX_URL)};
+
+const app = Application.init({ id: "dev.saucer.examples.notification-bus" });
+const supported = Notification.isSupported();
+
+const burst = await Promise.all(
+  Array.from({ length: 12 }, (_, i) => new Notification({ title: "burst-" + i, body: "burst" }).show()),
+);
+
+const updated = new Notification({ title: "update", body: "v0" });
+const updates = await Promise.all(Array.from({ length: 10 }, (_, i) => updated.show({ body: "v" + (i + 1) })));
+
+const clicks = [];
+const closes = [];
+const clicked = new Notification({
+  title: "click-me",
+  body: "callbacks",
+  onClick: (action) => clicks.push(action),
+  onClose: (reason) => closes.push(reason),
+});
+const clickId = await clicked.show();
+
+const deadline = Date.now() + 3000;
+while (closes.length === 0 && Date.now() < deadline) {
+  await new Promise((resolve) => setTimeout(resolve, 50));
+}
+
+console.log(JSON.stringify({ supported, burst, updates, clickId, clicks, closes }));
+app.quit();
+process.exit(0);
+`;
+
+// Runs in a child: a manual-mode app can't share the process with the libuv-driven one under test
+const MANUAL_LOOP_CHILD = `
+import { Application } from ${JSON.stringify(INDEX_URL)};
+
+const app = Application.init({ id: "dev.saucer.examples.manual-loop", loop: "manual" });
+const report = {};
+
+report.single = app.step();
+report.bounded = app.step({ maxIterations: 5 });
+
+let ran = 0;
+for (let i = 0; i < 3; i++) app.post(() => ran++);
+report.ranBeforeStep = ran;
+report.drained = app.step({ untilIdle: true });
+report.ranInStep = ran;
+
+// A task that re-posts itself keeps the loop busy, so only the timeout ends the step
+let spinning = true;
+let spins = 0;
+const spin = () => {
+  spins++;
+  if (spinning) app.post(spin);
+};
+app.post(spin);
+report.timed = app.step({ untilIdle: true, timeoutMs: 50 });
+spinning = false;
+app.step({ untilIdle: true, timeoutMs: 1000 });
+report.spins = spins;
+
+try {
+  app.step({ maxIterations: 0 });
+  report.rangeError = false;
+} catch (error) {
+  report.rangeError = error instanceof RangeError;
+}
+
+report.metricsTasks = app.metrics().loop.tasks;
+
+console.log(JSON.stringify(report));
+app.quit();
+process.exit(0);
+`;
+
+async function testManualLoop() {
+  const name = "app.step (manual loop)";
+
+  try {
+    const result = await runChild(process.execPath, ["--input-type=module", "-e", MANUAL_LOOP_CHILD]);
+    if (result.code !== 0) {
+      testFail(name, `Child exited with ${result.code}: ${result.stderr.trim()}`);
+      return;
+    }
+
+    const report = JSON.parse(result.stdout.trim().split("\n").pop());
+
+    if (report.single.iterations === 1 && report.bounded.iterations === 5) {
+      testPass(`${name}: maxIterations`, "Ran 1 iteration by default and 5 with maxIterations: 5");
+    } else {
+      testFail(`${name}: maxIterations`, `Iterations ${report.single.iterations} / ${report.bounded.iterations}`);
+    }
+
+    if (report.ranBeforeStep === 0 && report.ranInStep === 3 && report.drained.idle && report.drained.tasks >= 1) {
+      testPass(`${name}: untilIdle`, `post() callbacks ran inside step(): ${JSON.stringify(report.drained)}`);
+    } else {
+      testFail(`${name}: untilIdle`, `ran ${report.ranBeforeStep} -> ${report.ranInStep}, ${JSON.stringify(report.drained)}`);
+    }
+
+    if (!report.timed.idle && report.timed.elapsed >= 45 && report.timed.elapsed < 1000 && report.spins > 1) {
+      testPass(`${name}: timeoutMs`, `Busy loop stopped after ${report.timed.elapsed.toFixed(1)}ms, ${report.spins} spins`);
+    } else {
+      testFail(`${name}: timeoutMs`, `${JSON.stringify(report.timed)}, ${report.spins} spins`);
+    }
+
+    if (report.rangeError && report.metricsTasks >= report.drained.tasks + report.timed.tasks) {
+      testPass(`${name}: counters`, `RangeError for maxIterations: 0, metrics().loop.tasks = ${report.metricsTasks}`);
+    } else {
+      testFail(`${name}: counters`, `rangeError ${report.rangeError}, metrics().loop.tasks ${report.metricsTasks}`);
+    }
+  } catch (error) {
+    testFail(name, "Manual loop child failed", error);
+  }
+}
+
+async function testNotificationBus() {
+  const name = "Notification (mock D-Bus)";
+  let daemon = null;
+  let server = null;
+
+  try {
+    try {
+      daemon = await startHelper("dbus-daemon", ["--session", "--print-address=1", "--nofork"], process.env);
+    } catch (error) {
+      testWarn(name, `dbus-daemon unavailable, skipped: ${error.message}`);
+      return;
+    }
+
+    const env = { ...process.env, DBUS_SESSION_BUS_ADDRESS: daemon.first };
+
+    try {
+      server = await startHelper("python3", ["-c", MOCK_NOTIFICATION_SERVER], env);
+    } catch (error) {
+      testWarn(name, `python3 with gi unavailable, skipped: ${error.message}`);
+      return;
+    }
+
+    const result = await runChild(process.execPath, ["--input-type=module", "-e", NOTIFICATION_CHILD], { env });
+    if (result.code !== 0) {
+      testFail(name, `Child exited with ${result.code}: ${result.stderr.trim()}`);
+      return;
+    }
+
+    const report = JSON.parse(result.stdout.trim().split("\n").pop());
+    const sent = server.lines.filter((line) => line.trim()).map((line) => JSON.parse(line));
+    const burstSends = sent.filter((entry) => entry.title.startsWith("burst-"));
+
+    // Rate limiter: 8 go out together, the rest follow at ~4 per second
+    const start = burstSends[0]?.t ?? 0;
+    const immediate = burstSends.filter((entry) => entry.t - start < 150).length;
+    const gaps = burstSends.slice(8).map((entry, i) => entry.t - (i === 0 ? start : burstSends[i + 7].t));
+    if (burstSends.length === 12 && immediate === 8 && gaps.every((gap) => gap >= 200)) {
+      testPass(`${name}: rate limit`, `8 immediate, then gaps of ${gaps.map((gap) => Math.round(gap)).join("/")}ms`);
+    } else {
+      testFail(`${name}: rate limit`, `${burstSends.length} sends, ${immediate} immediate, gaps ${JSON.stringify(gaps)}`);
+    }
+
+    if (new Set(report.burst).size === 12 && report.burst.every((id) => typeof id === "number")) {
+      testPass(`${name}: ids`, "Every burst notification got its own id");
+    } else {
+      testFail(`${name}: ids`, `Unexpected ids: ${JSON.stringify(report.burst)}`);
+    }
+
+    // Coalescing: ten queued updates become one Notify with the newest body, and all resolve to its id
+    const updateSends = sent.filter((entry) => entry.title === "update");
+    if (updateSends.length === 1 && updateSends[0].body === "v10"
+        && report.updates.every((id) => id === updateSends[0].id)) {
+      testPass(`${name}: coalescing`, "10 updates sent as one Notify with the last body");
+    } else {
+      testFail(`${name}: coalescing`, `Sends ${JSON.stringify(updateSends)}, ids ${JSON.stringify(report.updates)}`);
+    }
+
+    if (report.clicks.join() === "default" && report.closes.join() === "2") {
+      testPass(`${name}: callbacks`, `onClick("default") and onClose(2) for id ${report.clickId}`);
+    } else {
+      testFail(`${name}: callbacks`, `clicks ${JSON.stringify(report.clicks)}, closes ${JSON.stringify(report.closes)}`);
+    }
+
+    // Without a reachable bus show() resolves null instead of rejecting
+    const missing = await runChild(process.execPath, ["--input-type=module", "-e", `
+import { Application, Notification } from ${JSON.stringify(INDEX_URL)};
+const app = Application.init({ id: "dev.saucer.examples.notification-nobus" });
+const id = await new Notification({ title: "nobody", body: "listening" }).show();
+console.log(JSON.stringify({ id }));
+app.quit();
+process.exit(0);
+`], { env: { ...process.env, DBUS_SESSION_BUS_ADDRESS: "unix:path=/nonexistent/saucer-test-bus" } });
+
+    const missingReport = missing.code === 0 ? JSON.parse(missing.stdout.trim().split("\n").pop()) : null;
+    if (missingReport && missingReport.id === null) {
+      testPass(`${name}: no bus`, "show() resolved null without a session bus");
+    } else {
+      testFail(`${name}: no bus`, `Expected null, got ${missing.stdout.trim() || missing.stderr.trim()}`);
+    }
+  } catch (error) {
+    testFail(name, "Mock D-Bus test failed", error);
+  } finally {
+    server?.child.kill();
+    daemon?.child.kill();
+  }
+}
+
 // Prompt user for test mode
 async function promptTestMode() {
   return new Promise((resolve) => {
@@ -1710,6 +2070,23 @@ async function main() {
     testFail("Stash", "Failed to test Stash class", error);
   }
 
+  // Test shared stash deduplication
+  try {
+    const payload = Buffer.from(`shared-stash-${Date.now()}`);
+    const first = Stash.from(payload);
+    const before = Stash.sharedStats();
+    const second = Stash.from(Buffer.from(payload));
+    const after = Stash.sharedStats();
+
+    if (first && second && after.entries <= before.entries && after.bytes <= before.bytes) {
+      testPass("Stash.sharedStats", "Identical contents share a single stash entry");
+    } else {
+      testFail("Stash.sharedStats", `Unexpected shared stats: ${JSON.stringify({ before, after })}`);
+    }
+  } catch (error) {
+    testFail("Stash.sharedStats", "Failed to test shared stash store", error);
+  }
+
   // Test Stash.view
   try {
     const testData = Buffer.from("View test data");
@@ -1864,6 +2241,34 @@ async function main() {
     } else {
       testFail("Desktop.pickFolders", "pickFolders method not found");
     }
+
+    // Async pickers: timers must keep firing while the dialog is open, and aborting closes it with null
+    for (const name of ["pickFileAsync", "pickFoldersAsync"]) {
+      const controller = new AbortController();
+      let ticks = 0;
+      const ticker = setInterval(() => ticks++, 20);
+
+      try {
+        const pending = desktop[name]({ signal: controller.signal });
+        await new Promise((r) => setTimeout(r, 300));
+        controller.abort();
+        const selection = await pending;
+
+        if (selection === null && ticks >= 5) {
+          testPass(`Desktop.${name}`, `Event loop ran ${ticks} ticks while the dialog was open; abort resolved null`);
+        } else {
+          testFail(`Desktop.${name}`, `Expected null after abort with a live loop, got ${JSON.stringify(selection)} after ${ticks} ticks`);
+        }
+      } catch (error) {
+        if (process.platform !== "linux" && /not supported/.test(error.message)) {
+          testWarn(`Desktop.${name}`, error.message);
+        } else {
+          testFail(`Desktop.${name}`, "Non-blocking picker failed", error);
+        }
+      } finally {
+        clearInterval(ticker);
+      }
+    }
   } catch (error) {
     testFail("Desktop", "Failed to test Desktop class", error);
   }
@@ -1886,10 +2291,221 @@ async function main() {
     } else {
       testFail("PDF.save", "save method not found");
     }
+
+    if (typeof pdf.saveAsync === "function") {
+      testPass("PDF.saveAsync", "saveAsync method is available");
+      // Note: Not called here, exporting requires a loaded page and would write output
+    } else {
+      testFail("PDF.saveAsync", "saveAsync method not found");
+    }
   } catch (error) {
     testFail("PDF", "Failed to test PDF class", error);
   }
 
+  // RenderPool (construct, render, inspect and close)
+  try {
+    const pool = new RenderPool(app, { size: 1 });
+    const stats = pool.stats;
+    if (stats.size === 1 && stats.pending === 0 && stats.jobsPerSecond === 0) {
+      testPass("RenderPool.stats", "Pool created with one pre-warmed view");
+    } else {
+      testFail("RenderPool.stats", `Unexpected stats: ${JSON.stringify(stats)}`);
+    }
+
+    const invalid = await pool.render({}).then(
+      () => false,
+      (error) => error instanceof TypeError,
+    );
+    if (invalid) {
+      testPass("RenderPool.render", "Rejects jobs without html or url");
+    } else {
+      testFail("RenderPool.render", "Invalid job was not rejected");
+    }
+
+    // A real render: the Buffer must hold a PDF, and closing right after must not cut the export short
+    const rendered = pool.render({ html: "<h1>RenderPool</h1>" });
+    const buffer = await rendered;
+    if (Buffer.isBuffer(buffer) && buffer.length > 0 && buffer.subarray(0, 4).toString("latin1") === "%PDF") {
+      testPass("RenderPool.render", `Rendered ${buffer.length} bytes of PDF`);
+    } else {
+      testFail("RenderPool.render", `Expected a PDF Buffer, got ${Buffer.isBuffer(buffer) ? buffer.subarray(0, 8).toString("latin1") : typeof buffer}`);
+    }
+
+    const inFlight = pool.render({ html: "<p>closing</p>" });
+    await pool.close();
+    const inFlightResult = await inFlight.then((value) => value, (error) => error);
+    if (Buffer.isBuffer(inFlightResult) || inFlightResult?.message === "RenderPool is closed") {
+      testPass("RenderPool.close", "In-flight job settled before its view was closed");
+    } else {
+      testFail("RenderPool.close", "In-flight job failed while closing", inFlightResult);
+    }
+
+    const closed = await pool.render({ html: "<p></p>" }).then(
+      () => false,
+      () => true,
+    );
+    if (closed) {
+      testPass("RenderPool.close", "Closed pool rejects new jobs");
+    } else {
+      testFail("RenderPool.close", "Closed pool accepted a job");
+    }
+
+    // A warm-up that times out still returns its view to the pool
+    const slow = new RenderPool(app, { size: 1, loadTimeout: 1 });
+    const warmFailed = await slow.ready.then(() => false, () => true);
+    if (!warmFailed || slow.stats.idle === 1) {
+      testPass("RenderPool.ready", `Warm-up ${warmFailed ? "timed out" : "finished"}, idle views: ${slow.stats.idle}`);
+    } else {
+      testFail("RenderPool.ready", `View lost after failed warm-up: ${JSON.stringify(slow.stats)}`);
+    }
+    slow.close();
+  } catch (error) {
+    testFail("RenderPool", "Failed to test RenderPool", error);
+  }
+
+  // Startup timeline
+  try {
+    const timeline = app.getStartupTimeline();
+    const names = timeline.marks.map((mark) => mark.name);
+    if (names.includes("application.constructor") && names.includes("saucer_new")) {
+      testPass("app.getStartupTimeline", `${names.length} marks (complete: ${timeline.complete})`);
+    } else {
+      testFail("app.getStartupTimeline", `Missing startup marks: ${names.join(", ")}`);
+    }
+
+    const trace = JSON.parse(app.getStartupTimeline({ format: "trace" }));
+    if (Array.isArray(trace.traceEvents) && trace.traceEvents.length === timeline.marks.length) {
+      testPass("app.getStartupTimeline(trace)", "Chrome trace-event JSON produced");
+    } else {
+      testFail("app.getStartupTimeline(trace)", "Trace output did not match timeline");
+    }
+  } catch (error) {
+    testFail("app.getStartupTimeline", "Failed to read startup timeline", error);
+  }
+
+  // Native tracer
+  try {
+    if (app.startTracing({ eventsPerThread: 1024 })) {
+      await app.dispatch(() => 1);
+      const trace = JSON.parse(app.stopTracing());
+      const names = new Set(trace.traceEvents.map((event) => event.name));
+      if (names.has("run_once") && names.has("dispatch")) {
+        testPass("app.startTracing", `Recorded ${trace.traceEvents.length} trace events`);
+      } else {
+        testFail("app.startTracing", `Missing spans: ${[...names].join(", ")}`);
+      }
+    } else {
+      testWarn("app.startTracing", "Addon built without tracing support");
+    }
+  } catch (error) {
+    testFail("app.startTracing", "Failed to record a trace", error);
+  }
+
+  // Native metrics
+  try {
+    const metrics = app.metrics();
+    if (metrics.loop.iterations > 0 && metrics.loop.iterationTime.count > 0 && typeof metrics.tsfn.calls === "number") {
+      testPass("app.metrics", `${metrics.loop.iterations} loop iterations, p99 ${metrics.loop.iterationTime.p99.toFixed(3)}ms`);
+    } else {
+      testFail("app.metrics", `Unexpected metrics: ${JSON.stringify(metrics.loop)}`);
+    }
+  } catch (error) {
+    testFail("app.metrics", "Failed to read metrics", error);
+  }
+
+  // WebviewPool (acquire, background refill, close)
+  try {
+    const pool = app.createWebviewPool({ size: 1 });
+    const acquired = pool.acquire();
+    if (acquired instanceof Webview && pool.stats.acquired === 1) {
+      testPass("WebviewPool.acquire", `Acquired webview (misses: ${pool.stats.misses})`);
+    } else {
+      testFail("WebviewPool.acquire", "acquire() did not return a Webview");
+    }
+    acquired.close();
+
+    // Refilled views only become available once their warm-up page has loaded
+    const refillDeadline = Date.now() + 5000;
+    while (pool.stats.available === 0 && Date.now() < refillDeadline) {
+      await new Promise((resolve) => setTimeout(resolve, 25));
+    }
+    if (pool.stats.available === 1) {
+      testPass("WebviewPool.refill", "Pool refilled in the background after the warm-up load");
+    } else {
+      testWarn("WebviewPool.refill", `Pool not yet refilled: ${JSON.stringify(pool.stats)}`);
+    }
+
+    pool.close();
+    try {
+      pool.acquire();
+      testFail("WebviewPool.close", "Closed pool handed out a webview");
+    } catch {
+      testPass("WebviewPool.close", "Closed pool rejects acquire()");
+    }
+  } catch (error) {
+    testFail("WebviewPool", "Failed to test WebviewPool", error);
+  }
+
+  // Shared web context / process model options
+  try {
+    const shared = [0, 1].map(
+      () => new Webview(app, { sharedContext: "features-test", cacheModel: "documentViewer", processLimit: 1 }),
+    );
+    testPass("Webview.sharedContext", "Created two webviews in one shared context group");
+    shared.forEach((view) => view.close());
+
+    try {
+      new Webview(app, { cacheModel: "bogus" }).close();
+      testFail("Webview.cacheModel", "Unknown cache model was accepted");
+    } catch (error) {
+      if (error instanceof TypeError) {
+        testPass("Webview.cacheModel", "Unknown cache model rejected");
+      } else {
+        testFail("Webview.cacheModel", "Unexpected error for unknown cache model", error);
+      }
+    }
+  } catch (error) {
+    testFail("Webview.sharedContext", "Failed to create shared-context webviews", error);
+  }
+
+  // RPC batching: same-microtask calls share one message and one batched resolve
+  try {
+    const batched = new Webview(app, { rpcBatching: "microtask" });
+    batched.expose("batchAdd", (a, b) => a + b);
+    batched.expose("batchFail", () => {
+      throw new Error("expected failure");
+    });
+
+    const ready = new Promise((resolve) => batched.once("dom-ready", resolve));
+    batched.loadHtml("<html><body>batching</body></html>");
+    await Promise.race([ready, new Promise((resolve) => setTimeout(resolve, 5000))]);
+
+    const results = await batched.evaluate(`Promise.all([
+      ...[1, 2, 3, 4].map((i) => window.saucer.exposed.batchAdd(i, 10)),
+      window.saucer.exposed.batchFail().then(() => "resolved", () => "rejected"),
+    ])`);
+
+    if (JSON.stringify(results) === JSON.stringify([11, 12, 13, 14, "rejected"])) {
+      testPass("Webview.rpcBatching", "Batched calls resolved individually, failures isolated");
+    } else {
+      testFail("Webview.rpcBatching", `Unexpected batched results: ${JSON.stringify(results)}`);
+    }
+    batched.close();
+
+    try {
+      new Webview(app, { rpcBatching: "sometimes" }).close();
+      testFail("Webview.rpcBatching validation", "Unknown batching mode was accepted");
+    } catch (error) {
+      if (error instanceof TypeError) {
+        testPass("Webview.rpcBatching validation", "Unknown batching mode rejected");
+      } else {
+        testFail("Webview.rpcBatching validation", "Unexpected error for unknown batching mode", error);
+      }
+    }
+  } catch (error) {
+    testFail("Webview.rpcBatching", "Failed to exercise RPC batching", error);
+  }
+
   // Window events
   console.log("\n--- WINDOW EVENTS ---");
   let onceLoadCount = 0;
@@ -2116,6 +2732,18 @@ async function main() {
       },
       { async: true },
     );
+    // Raw passthrough: arguments arrive as unparsed JSON, the string result goes back verbatim
+    webview.expose("rawForward", (args) => `{"forwarded":${args}}`, { raw: true });
+    webview.expose("rawBroken", () => "{not json", { raw: true });
+    try {
+      webview.expose("rawLaunch", () => "null", { raw: true, launch: "async" });
+      testFail("webview.expose raw options", "raw combined with launch was accepted");
+    } catch (error) {
+      testPass("webview.expose raw options", "raw combined with launch is rejected");
+    }
+    // Binary arguments and results travel as base64 and arrive as Buffer / Uint8Array
+    webview.expose("reverseBytes", (bytes) => Buffer.from(bytes).reverse());
+    webview.expose("nestedBytes", ({ data }) => ({ isBuffer: Buffer.isBuffer(data), data: Buffer.from(data).reverse() }));
     // Expose a temporary function to test clearExposed
     webview.expose("tempFunc", () => "temp");
     testPass("webview.expose", "Registered Smartview RPC handlers");
@@ -2171,6 +2799,101 @@ async function main() {
     testFail("app.dispatch", "Failed to execute dispatch", error);
   }
 
+  // Test priority lanes: a user-blocking task overtakes queued background work
+  try {
+    const order = [];
+    const backgroundDone = Promise.all(
+      [1, 2, 3].map((i) => app.dispatch(() => order.push(`background-${i}`), { priority: "background" })),
+    );
+    await app.dispatch(() => order.push("user-blocking"), { priority: "user-blocking" });
+    await backgroundDone;
+
+    if (order[0] === "user-blocking" && order.length === 4) {
+      testPass("app.post priority", `Lane order: ${order.join(", ")}`);
+    } else {
+      testFail("app.post priority", `User-blocking task did not run first: ${order.join(", ")}`);
+    }
+
+    let threw = false;
+    try {
+      app.post(() => {}, { priority: "urgent" });
+    } catch (error) {
+      threw = error instanceof TypeError;
+    }
+    if (threw) {
+      testPass("app.post priority validation", "Unknown priority throws TypeError");
+    } else {
+      testFail("app.post priority validation", "Unknown priority was accepted");
+    }
+  } catch (error) {
+    testFail("app.post priority", "Failed to exercise priority lanes", error);
+  }
+
+  // Test keyed post(): newer posts replace pending ones, cancel() drops them
+  try {
+    const ran = [];
+    for (let i = 1; i <= 5; i++) {
+      app.post(() => ran.push(`refresh-${i}`), { key: "saucer-refresh" });
+    }
+    app.post(() => ran.push("cancelled"), { key: "saucer-cancelled" });
+    const cancelled = app.cancel("saucer-cancelled");
+    await app.dispatch(() => {});
+
+    if (ran.length === 1 && ran[0] === "refresh-5" && cancelled && !app.cancel("saucer-cancelled")) {
+      testPass("app.post key", "Only the newest keyed post ran; cancel() dropped the other");
+    } else {
+      testFail("app.post key", `Unexpected keyed post result: ran=[${ran.join(", ")}], cancelled=${cancelled}`);
+    }
+  } catch (error) {
+    testFail("app.post key", "Failed to exercise keyed posts", error);
+  }
+
+  // Test cancel()/re-key from inside a running user-blocking callback
+  try {
+    const ran = [];
+    app.post(
+      () => {
+        ran.push("first");
+        app.cancel("saucer-urgent-b");
+        app.post(() => ran.push("c-rekeyed"), { key: "saucer-urgent-c", priority: "background" });
+      },
+      { priority: "user-blocking" },
+    );
+    app.post(() => ran.push("b"), { key: "saucer-urgent-b", priority: "user-blocking" });
+    app.post(() => ran.push("c"), { key: "saucer-urgent-c", priority: "user-blocking" });
+    await app.dispatch(() => {}, { priority: "background" });
+    await app.dispatch(() => {}, { priority: "background" });
+
+    if (JSON.stringify(ran) === JSON.stringify(["first", "c-rekeyed"])) {
+      testPass("app.cancel in callback", "Cancelled and re-keyed user-blocking tasks were skipped safely");
+    } else {
+      testFail("app.cancel in callback", `Unexpected run order: ${ran.join(", ")}`);
+    }
+  } catch (error) {
+    testFail("app.cancel in callback", "Failed to cancel from inside a running callback", error);
+  }
+
+  // Test requestIdle(): runs once the loop is idle and can be cancelled
+  try {
+    const cancelled = app.requestIdle(() => testFail("app.cancelIdle", "Cancelled idle callback ran"));
+    const removed = app.cancelIdle(cancelled);
+    const deadline = await new Promise((resolve) => app.requestIdle(resolve, { timeout: 2000 }));
+
+    if (typeof deadline.didTimeout === "boolean" && typeof deadline.timeRemaining() === "number") {
+      testPass("app.requestIdle", `Ran with didTimeout=${deadline.didTimeout}`);
+    } else {
+      testFail("app.requestIdle", "Callback did not receive an idle deadline");
+    }
+
+    if (removed && !app.cancelIdle(cancelled)) {
+      testPass("app.cancelIdle", "Pending callback removed once");
+    } else {
+      testFail("app.cancelIdle", "cancelIdle() did not report the pending callback");
+    }
+  } catch (error) {
+    testFail("app.requestIdle", "Failed to run idle callback", error);
+  }
+
   // Test make(): alias for dispatch that returns a value
   try {
     const makeResult = await app.make(() => {
@@ -2227,10 +2950,64 @@ async function main() {
     testFail("app.poolEmplace", "Failed to execute poolEmplace", error);
   }
 
-  // Verify run() is a harmless no-op in these bindings
+  // Stall watchdog: block the thread in a named function and expect a stall event naming it
+  try {
+    const stalls = [];
+    const onStall = (stall) => stalls.push(stall);
+    app.on("stall", onStall);
+    app.startStallWatchdog({ thresholdMs: 50, captureStack: true });
+    await new Promise((resolve) => setTimeout(resolve, 200)); // let the sampler attach
+
+    const blockTheLoop = () => {
+      const until = performance.now() + 250;
+      while (performance.now() < until) {
+        // busy wait
+      }
+    };
+    blockTheLoop();
+
+    await new Promise((resolve) => setTimeout(resolve, 300));
+    app.stopStallWatchdog();
+    app.off("stall", onStall);
+
+    const stall = stalls.find((entry) => entry.duration >= 50);
+    if (!stall) {
+      testFail("app.startStallWatchdog", `No stall reported (${stalls.length} events)`);
+    } else if (stall.stack && stall.stack.some((frame) => frame.functionName === "blockTheLoop")) {
+      testPass("app.startStallWatchdog", `Stall of ${stall.duration.toFixed(0)}ms attributed to blockTheLoop`);
+    } else {
+      testWarn(
+        "app.startStallWatchdog",
+        `Stall of ${stall.duration.toFixed(0)}ms reported without the blocking frame (stack: ${stall.stack ? stall.stack.length : "none"})`,
+      );
+    }
+  } catch (error) {
+    testFail("app.startStallWatchdog", "Stall watchdog failed", error);
+  }
+
+  // step() is only available with loop: "manual"
+  try {
+    app.step();
+    testFail("app.step", "step() should throw outside manual loop mode");
+  } catch (error) {
+    if (/manual/.test(error.message)) {
+      testPass("app.step", "Rejected outside manual loop mode");
+    } else {
+      testFail("app.step", "Unexpected step() error", error);
+    }
+  }
+
+  await testManualLoop();
+
+  // Verify run() is a harmless no-op with the default libuv-owned loop
   try {
-    app.run();
-    testPass("app.run", "Called successfully (no-op in Node.js bindings)");
+    const runResult = app.run();
+    if (runResult instanceof Promise) {
+      await runResult;
+      testPass("app.run", "Resolved immediately (libuv-owned loop)");
+    } else {
+      testFail("app.run", `Expected a Promise, got ${typeof runResult}`);
+    }
   } catch (error) {
     testFail("app.run", "run() threw an error", error);
   }
@@ -2624,6 +3401,23 @@ async function main() {
     }
   }, 10000);
 
+  // Several listeners for one event must each run exactly once per native firing
+  const fanoutTitle = "Saucer Fanout Check";
+  const fanoutCounts = [0, 0, 0];
+  const fanoutListeners = fanoutCounts.map((_, index) => (title) => {
+    if (title === fanoutTitle) {
+      fanoutCounts[index] += 1;
+    }
+  });
+  setTimeout(() => {
+    try {
+      fanoutListeners.forEach((listener) => webview.on("title", listener));
+      webview.execute(`document.title = '${fanoutTitle}';`);
+    } catch (error) {
+      testFail("event fan-out", "Failed to register title listeners", error);
+    }
+  }, 10500);
+
   // Update title from inside the webview to exercise the title event
   const lastUITest = new Promise((resolve) => {
     setTimeout(() => {
@@ -2645,6 +3439,16 @@ async function main() {
           );
         }
 
+        fanoutListeners.forEach((listener) => webview.off("title", listener));
+        if (fanoutCounts.every((count) => count === 1)) {
+          testPass("event fan-out", "3 title listeners each invoked once per event");
+        } else {
+          testFail(
+            "event fan-out",
+            `Expected each listener to run once, got ${fanoutCounts.join(", ")}`,
+          );
+        }
+
         if (offNavigateCount === 0) {
           testPass("webview.off behavior", "Removed navigate listener was not invoked");
         } else {
@@ -2775,6 +3579,87 @@ async function main() {
         );
       }
 
+      try {
+        const rawResult = await webview.evaluate(
+          "window.saucer.exposed.rawForward({ id: 7 }, 'x')"
+        );
+        if (JSON.stringify(rawResult) === JSON.stringify({ forwarded: [{ id: 7 }, "x"] })) {
+          testPass("webview.expose raw", "Raw handler forwarded the JSON arguments untouched");
+        } else {
+          testFail("webview.expose raw", `Unexpected raw result: ${JSON.stringify(rawResult)}`);
+        }
+      } catch (error) {
+        testFail("webview.expose raw", "Failed to invoke raw RPC handler", error);
+      }
+
+      try {
+        const outcome = await webview.evaluate(
+          "window.saucer.exposed.rawBroken().then(() => 'resolved', (error) => String(error))"
+        );
+        if (typeof outcome === "string" && outcome.includes("not valid JSON")) {
+          testPass("webview.expose raw validation", "Invalid raw JSON result rejects the call");
+        } else {
+          testFail("webview.expose raw validation", `Unexpected outcome: ${JSON.stringify(outcome)}`);
+        }
+      } catch (error) {
+        testFail("webview.expose raw validation", "Failed to invoke raw RPC handler", error);
+      }
+
+      try {
+        const bytes = Buffer.from([1, 2, 3, 250]);
+        const pageView = await webview.evaluate(
+          "(b => b instanceof Uint8Array ? Array.from(b) : null)({})",
+          bytes,
+        );
+        const roundTrip = await webview.evaluate(
+          "window.saucer.exposed.reverseBytes(new Uint8Array([7, 8, 9])).then(r => r instanceof Uint8Array ? r : null)"
+        );
+        if (
+          JSON.stringify(pageView) === JSON.stringify([1, 2, 3, 250]) &&
+          Buffer.isBuffer(roundTrip) &&
+          roundTrip.equals(Buffer.from([9, 8, 7]))
+        ) {
+          testPass("webview binary arguments", "Buffer <-> Uint8Array in evaluate and expose");
+        } else {
+          testFail(
+            "webview binary arguments",
+            `Unexpected binary transfer: page=${JSON.stringify(pageView)}, result=${JSON.stringify(roundTrip)}`,
+          );
+        }
+      } catch (error) {
+        testFail("webview binary arguments", "Failed to transfer binary values", error);
+      }
+
+      // Nested binary values in both directions, without patching the page's prototypes
+      try {
+        const pageView = await webview.evaluate(
+          "(o => o.inner.bytes instanceof Uint8Array ? Array.from(o.inner.bytes) : null)({})",
+          { inner: { bytes: Buffer.from([4, 5, 6]) } },
+        );
+        const nested = await webview.evaluate(
+          `window.saucer.exposed.nestedBytes({ data: new Uint8Array([1, 2]) }).then((r) => ({
+            isBuffer: r.isBuffer,
+            revived: r.data instanceof Uint8Array,
+            data: r.data,
+            patched: "toJSON" in Uint8Array.prototype || "toJSON" in ArrayBuffer.prototype,
+          }))`,
+        );
+        if (
+          JSON.stringify(pageView) === JSON.stringify([4, 5, 6]) &&
+          nested.isBuffer &&
+          nested.revived &&
+          Buffer.isBuffer(nested.data) &&
+          nested.data.equals(Buffer.from([2, 1])) &&
+          !nested.patched
+        ) {
+          testPass("webview nested binary", "Nested Buffer <-> Uint8Array in evaluate and expose");
+        } else {
+          testFail("webview nested binary", `Unexpected nested transfer: page=${JSON.stringify(pageView)}, result=${JSON.stringify(nested)}`);
+        }
+      } catch (error) {
+        testFail("webview nested binary", "Failed to transfer nested binary values", error);
+      }
+
       try {
         const formattedResult = await webview.evaluate(
           "({}.value + {})",
@@ -2939,6 +3824,21 @@ async function main() {
           testFail("clipboard.readText", `Expected "${testText}", got "${readText}"`);
         }
 
+        // Test async clipboard read
+        const asyncText = await clipboard.readTextAsync();
+        if (asyncText === testText) {
+          testPass("clipboard.readTextAsync", "Async read matches written text");
+        } else {
+          testFail("clipboard.readTextAsync", `Expected "${testText}", got "${asyncText}"`);
+        }
+
+        const asyncImage = await clipboard.readImageAsync().catch((error) => error);
+        if (asyncImage === null || Buffer.isBuffer(asyncImage)) {
+          testPass("clipboard.readImageAsync", `Resolved with ${asyncImage === null ? "null" : "a Buffer"}`);
+        } else {
+          testFail("clipboard.readImageAsync", `Unexpected result: ${asyncImage}`);
+        }
+
         // Test clipboard hasText
         const hasText = clipboard.hasText();
         if (hasText === true) {
@@ -3002,11 +3902,22 @@ async function main() {
 
         // Test notification.show (skip in automated mode to avoid popup)
         if (testMode === "manual") {
-          notification.show();
-          testPass("notification.show", "Notification displayed (check system tray)");
+          const id = await notification.show();
+          testPass("notification.show", `Notification displayed (check system tray), id: ${id}`);
+
+          const updatedId = await notification.show({ body: "Updated in place" });
+          if (id === null || updatedId === id) {
+            testPass("notification.show (update)", "Repeated show() updates the same notification");
+          } else {
+            testWarn("notification.show (update)", `Server assigned a new id: ${id} -> ${updatedId}`);
+          }
         } else {
           testPass("notification.show (skipped)", "Skipped in automated mode");
         }
+
+        if (process.platform === "linux") {
+          await testNotificationBus();
+        }
       } catch (error) {
         testFail("Notification API", "Notification tests failed", error);
       }
@@ -3184,6 +4095,79 @@ async function main() {
         testFail("Zoom API", "Zoom tests failed", error);
       }
 
+      // --------------------------------------------------------------------
+      // Batched Geometry Tests
+      // --------------------------------------------------------------------
+      console.log("\n--- Geometry API ---");
+
+      try {
+        const geometry = webview.getGeometry();
+        const size = webview.size;
+        const numeric = ["x", "y", "width", "height", "zoom"].every((key) => typeof geometry[key] === "number");
+        const flags = ["fullscreen", "maximized", "minimized"].every((key) => typeof geometry[key] === "boolean");
+
+        if (numeric && flags) {
+          testPass("webview.getGeometry", `Geometry: ${JSON.stringify(geometry)}`);
+        } else {
+          testFail("webview.getGeometry", `Unexpected geometry: ${JSON.stringify(geometry)}`);
+        }
+
+        if (geometry.width === size.width && geometry.height === size.height) {
+          testPass("webview.getGeometry size", "Matches webview.size");
+        } else {
+          testWarn("webview.getGeometry size", `Differs from webview.size: ${JSON.stringify(size)}`);
+        }
+      } catch (error) {
+        testFail("Geometry API", "Geometry tests failed", error);
+      }
+
+      try {
+        const before = webview.title;
+        let rejected = false;
+        try {
+          webview.apply({ title: "should-not-apply", size: { width: "wide" } });
+        } catch (error) {
+          rejected = error instanceof TypeError;
+        }
+
+        if (rejected && webview.title === before) {
+          testPass("webview.apply validation", "Invalid batch rejected without partial changes");
+        } else {
+          testFail("webview.apply validation", `Expected TypeError and unchanged title, got "${webview.title}"`);
+        }
+
+        const batchTitle = `apply-${Date.now()}`;
+        webview.apply({ title: batchTitle, minSize: { width: 200, height: 150 }, size: { width: 820, height: 620 } });
+        await new Promise((r) => setTimeout(r, 100));
+
+        if (webview.title === batchTitle) {
+          testPass("webview.apply", `Applied batch, size now ${JSON.stringify(webview.size)}`);
+        } else {
+          testFail("webview.apply", `Title not applied: "${webview.title}"`);
+        }
+
+        try {
+          webview.apply({ size: { width: 800, height: 600 }, position: { x: 40, y: 60 } });
+          await new Promise((r) => setTimeout(r, 200));
+          const geometry = webview.getGeometry();
+          if (geometry.x === 40 && geometry.y === 60) {
+            testPass("webview.apply position", "Size and position applied together");
+          } else {
+            testWarn("webview.apply position", `Window manager placed it at ${geometry.x},${geometry.y}`);
+          }
+        } catch (error) {
+          if (error instanceof TypeError) {
+            testWarn("webview.apply position", error.message);
+          } else {
+            throw error;
+          }
+        }
+
+        webview.apply({ title: before });
+      } catch (error) {
+        testFail("webview.apply", "Batched setter tests failed", error);
+      }
+
       console.log("\n--- Phase 3 Tests Complete ---");
       resolve();
     }, 12500); // Run after other UI tests complete
@@ -18,6 +18,16 @@ export interface ApplicationOptions {
    * @default CPU core count
    */
   threads?: number;
+
+  /**
+   * Event loop ownership.
+   * - `"libuv"`: libuv hooks pump saucer; `run()` is a no-op
+   * - `"native"`: after `run()` the native loop does the blocking wait and wakes libuv when it has work due
+   *   (Linux/GLib; other platforms keep the libuv integration)
+   * - `"manual"`: nothing pumps saucer; advance it with `app.step()`
+   * @default "libuv"
+   */
+  loop?: "libuv" | "native" | "manual";
 }
 
 /**
@@ -57,6 +67,31 @@ export interface WebviewOptions {
    * This script runs at creation time and persists across navigations
    */
   preload?: string;
+
+  /**
+   * Coalesce the page's `window.saucer.exposed.*` calls made in the same microtask
+   * (or animation frame) into one message and one batched resolve. Raw handlers
+   * (`expose(..., { raw })`) cannot be called while batching is enabled.
+   */
+  rpcBatching?: "microtask" | "frame";
+
+  /**
+   * Share one web context (data store and network/browser process) with every
+   * webview created with the same group name; `true` joins the "default" group
+   */
+  sharedContext?: boolean | string;
+
+  /**
+   * Web process cache model (WebKitGTK); "documentViewer" minimizes memory use
+   * @default "default"
+   */
+  cacheModel?: "default" | "documentViewer" | "documentBrowser" | "webBrowser";
+
+  /**
+   * Upper bound on web processes (webkit2gtk-4.0 before WebKitGTK 2.26, WebView2 renderer
+   * processes). Unsupported on webkitgtk-6.0, where the constructor throws a TypeError
+   */
+  processLimit?: number;
 }
 
 /**
@@ -268,21 +303,40 @@ export class Application {
   quit(): void;
 
   /**
-   * Run the application event loop
-   * Note: In Node.js bindings, this is automatically handled by libuv integration
+   * Run the application event loop.
+   * Resolves immediately by default; with `loop: "native"` it resolves once the native loop exits after `quit()`.
    */
-  run(): void;
+  run(): Promise<void>;
 
   /**
    * Post a callback to run on the main thread
    * @param callback Function to execute on the main thread
+   * @param options Lane to queue the callback in (default "normal")
    */
-  post(callback: () => void): void;
+  post(callback: () => void, options?: PostOptions & { key?: string }): void;
+
+  /**
+   * Drop the pending post() queued under `key`
+   * @returns Whether a pending callback was removed
+   */
+  cancel(key: string): boolean;
 
   /**
    * Dispatch work to the UI thread and resolve with the return value
    */
-  dispatch<T = unknown>(callback: () => T): Promise<T>;
+  dispatch<T = unknown>(callback: () => T, options?: PostOptions): Promise<T>;
+
+  /**
+   * Run the callback once the UI loop is idle, like requestIdleCallback
+   * @returns Handle for cancelIdle()
+   */
+  requestIdle(callback: (deadline: IdleDeadline) => void, options?: RequestIdleOptions): number;
+
+  /**
+   * Cancel a callback queued with requestIdle()
+   * @returns Whether a pending callback was removed
+   */
+  cancelIdle(handle: number): boolean;
 
   /**
    * Submit work to saucer's thread pool and await completion
@@ -299,6 +353,63 @@ export class Application {
    */
   make<T = unknown>(factory: () => T): Promise<T>;
 
+  /**
+   * Create a pool of hidden, pre-created webviews that can be acquired instantly
+   */
+  createWebviewPool(options?: WebviewPoolOptions): WebviewPool;
+
+  /**
+   * Native startup milestones in milliseconds since `performance.timeOrigin`
+   */
+  getStartupTimeline(options?: { format?: "object" }): StartupTimeline;
+
+  /**
+   * Native startup milestones as Chrome trace-event JSON (load in chrome://tracing or Perfetto)
+   */
+  getStartupTimeline(options: { format: "trace" }): string;
+
+  /**
+   * Start the native tracer (loop iterations, TSFN hops, RPC calls, evaluate, scheme requests)
+   * @returns false when the addon was built without tracing support
+   */
+  startTracing(options?: { eventsPerThread?: number }): boolean;
+
+  /**
+   * Stop the native tracer
+   * @returns Chrome trace-event JSON
+   */
+  stopTracing(): string;
+
+  /**
+   * Snapshot of the always-on native counters and latency histograms
+   */
+  metrics(): ApplicationMetrics;
+
+  /**
+   * Advance saucer's loop explicitly (requires `loop: "manual"`)
+   */
+  step(options?: StepOptions): StepResult;
+
+  /**
+   * Watch for stalls of the Node/UI thread and emit "stall" events
+   */
+  startStallWatchdog(options?: StallWatchdogOptions): void;
+
+  /**
+   * Stop the stall watchdog
+   */
+  stopStallWatchdog(): void;
+
+  /**
+   * Listen for application events
+   */
+  on(event: "stall", listener: (stall: StallEvent) => void): this;
+
+  /**
+   * Remove an application event listener (all listeners when omitted)
+   */
+  off(event: "stall", listener?: (stall: StallEvent) => void): this;
+
   /**
    * Get the raw native application pointer (unsafe)
    */
@@ -310,6 +421,147 @@ export class Application {
   readonly native: unknown;
 }
 
+/**
+ * A startup milestone; spans (e.g. `saucer_new`) have a non-zero duration
+ */
+export interface StartupMark {
+  name: string;
+  /** Milliseconds since `performance.timeOrigin` */
+  start: number;
+  /** Milliseconds; 0 for instants */
+  duration: number;
+}
+
+/**
+ * Startup timeline from addon load to the first page's dom-ready
+ */
+export interface StartupTimeline {
+  /** Whether the first page has reached dom-ready */
+  complete: boolean;
+  marks: StartupMark[];
+}
+
+/**
+ * Latency summary in milliseconds (log-linear histogram, ~12.5% precision)
+ */
+export interface LatencySummary {
+  count: number;
+  sum: number;
+  min: number;
+  max: number;
+  mean: number;
+  p50: number;
+  p90: number;
+  p99: number;
+}
+
+export interface PostOptions {
+  /**
+   * Lane to queue the task in. User-blocking tasks all run on the next pass; normal
+   * tasks get an 8 ms slice per pass and background tasks 2 ms (at least one task)
+   * @default "normal"
+   */
+  priority?: "user-blocking" | "normal" | "background";
+}
+
+export interface RequestIdleOptions {
+  /** Run the callback after this many milliseconds even if the loop never goes idle */
+  timeout?: number;
+}
+
+export interface IdleDeadline {
+  /** True when the callback runs because its timeout expired */
+  didTimeout: boolean;
+  /** Milliseconds left in the idle period (at most 50); 0 once UI work is pending */
+  timeRemaining(): number;
+}
+
+export interface StallWatchdogOptions {
+  /**
+   * Report stalls longer than this many milliseconds
+   * @default 100
+   */
+  thresholdMs?: number;
+  /**
+   * Sample the blocked JS stack through the inspector from a worker thread
+   * @default false
+   */
+  captureStack?: boolean;
+}
+
+export interface StallFrame {
+  functionName: string;
+  url: string;
+  line: number;
+  column: number;
+}
+
+export interface StallEvent {
+  /** How long the loop went without an iteration, in milliseconds */
+  duration: number;
+  /** Wall-clock start of the stall (epoch ms) */
+  startedAt: number;
+  /** JS stack of the blocked thread, innermost frame first; null when unavailable */
+  stack: StallFrame[] | null;
+}
+
+export interface StepOptions {
+  /**
+   * Upper bound on loop iterations
+   * @default 1, or 10000 with `untilIdle`
+   */
+  maxIterations?: number;
+  /** Keep iterating until the platform loop has no pending events */
+  untilIdle?: boolean;
+  /** Stop after this many milliseconds, even if work remains */
+  timeoutMs?: number;
+}
+
+export interface StepResult {
+  /** Loop iterations run */
+  iterations: number;
+  /** post/dispatch tasks processed */
+  tasks: number;
+  /** Callbacks handed to JS (run once control returns to the Node loop) */
+  callbacks: number;
+  /** Wall time in milliseconds */
+  elapsed: number;
+  /** Whether the platform loop was idle after the last iteration */
+  idle: boolean;
+}
+
+/**
+ * Native metrics snapshot returned by `app.metrics()`
+ */
+export interface ApplicationMetrics {
+  loop: {
+    /** saucer_application_run_once calls */
+    iterations: number;
+    iterationTime: LatencySummary;
+    /** post/dispatch tasks run by the UI loop */
+    tasks: number;
+    /** Keyed post() tasks superseded or cancelled before they ran */
+    coalesced: number;
+  };
+  /** Tasks waiting for the UI thread / thread pool */
+  queues: {
+    post: number;
+    dispatch: number;
+    pool: number;
+    /** Pending post/dispatch tasks per priority lane */
+    lanes: { userBlocking: number; normal: number; background: number };
+  };
+  /** Thread-safe function calls; `dropped` counts calls the queue refused */
+  tsfn: { calls: number; dropped: number };
+  /** Per exposed function name */
+  rpc: Record<string, { calls: number; errors: number; latency: LatencySummary }>;
+  /** Pooled exposed-call records; stops growing once the peak number of in-flight calls is reached */
+  rpcPool: { records: number };
+  /** Per custom scheme; `bytes` is response payload size */
+  schemes: Record<string, { requests: number; bytes: number; latency: LatencySummary }>;
+  evaluate: { latency: LatencySummary };
+}
+
 /**
  * Saucer Webview - a native webview window
  */
@@ -412,6 +664,18 @@ export class Webview {
    */
   zoom: number;
 
+  /**
+   * Read position, size, window state and zoom in a single native call
+   */
+  getGeometry(): WindowGeometry;
+
+  /**
+   * Set several window/webview properties in one native call
+   * The whole object is validated first; invalid input throws a TypeError without applying anything.
+   * `visible` is applied before maximized/fullscreen/minimized, which need a shown window on some platforms.
+   */
+  apply(properties: WindowProperties): void;
+
   /**
    * Parent application instance
    */
@@ -472,7 +736,8 @@ export class Webview {
   hide(): void;
 
   /**
-   * Close the window
+   * Close the window. With `PDF.saveAsync` exports of this webview still queued or
+   * rendering, the window closes once they have rendered
    */
   close(): void;
 
@@ -545,6 +810,17 @@ export class Webview {
     handler: (...args: any[]) => any,
     options?: { async?: boolean; launch?: "sync" | "async" },
   ): void;
+  /**
+   * Raw passthrough: the handler receives the call's arguments as one unparsed JSON array
+   * (a string, or a Buffer with `raw: "buffer"`). A string or Buffer result is sent to the
+   * page as-is and must be valid JSON (otherwise the call rejects); other results are
+   * JSON-stringified. Throws when combined with `launch` or `async`.
+   */
+  expose(
+    name: string,
+    handler: (args: string | Buffer) => string | Buffer | unknown | Promise<string | Buffer | unknown>,
+    options: { raw: true | "buffer" },
+  ): void;
 
   /**
    * Clear exposed RPC functions
@@ -650,12 +926,63 @@ export class Webview {
   onMessage(callback: (message: string) => boolean | void): void;
 }
 
+/**
+ * Properties accepted by `Webview.apply()`
+ */
+export interface WindowProperties {
+  title?: string;
+  size?: { width: number; height: number };
+  minSize?: { width: number; height: number };
+  maxSize?: { width: number; height: number };
+  /** Rejected with a TypeError where moves are not honoured (Wayland, Windows for now) */
+  position?: { x: number; y: number };
+  resizable?: boolean;
+  decorations?: boolean;
+  alwaysOnTop?: boolean;
+  clickThrough?: boolean;
+  maximized?: boolean;
+  minimized?: boolean;
+  fullscreen?: boolean;
+  /** Applied after geometry and before maximized/fullscreen/minimized */
+  visible?: boolean;
+  backgroundColor?: [number, number, number, number];
+  zoom?: number;
+  devTools?: boolean;
+  contextMenu?: boolean;
+  forceDarkMode?: boolean;
+}
+
+/**
+ * Snapshot returned by `Webview.getGeometry()`
+ */
+export interface WindowGeometry {
+  x: number;
+  y: number;
+  width: number;
+  height: number;
+  fullscreen: boolean;
+  maximized: boolean;
+  minimized: boolean;
+  zoom: number;
+}
+
+/**
+ * Shared stash store statistics
+ */
+export interface StashSharedStats {
+  /** Number of unique contents currently alive */
+  entries: number;
+  /** Total size of those contents in bytes */
+  bytes: number;
+}
+
 /**
  * Saucer Stash - raw byte buffer wrapper for efficient data handling
  */
 export class Stash {
   /**
    * Create a Stash from a Buffer (copies the data)
+   * Identical contents are deduplicated into one refcounted, process-wide copy
    * @param buffer Source buffer
    * @returns Stash instance or null on failure
    */
@@ -669,6 +996,12 @@ export class Stash {
    */
   static view(buffer: Buffer): Stash | null;
 
+  /**
+   * Statistics for the process-wide shared stash store used by `Stash.from` and `Webview.embed`
+   * @returns Number of unique live entries and their total size in bytes
+   */
+  static sharedStats(): StashSharedStats;
+
   /**
    * Get the size of the stash in bytes
    */
@@ -814,6 +1147,34 @@ export class Desktop {
    */
   pickFolders(options?: PickerOptions): string[] | null;
 
+  /**
+   * Show a file picker dialog without blocking the Node event loop
+   * @param options Picker options
+   * @returns Resolves with the selection, or null if cancelled
+   */
+  pickFileAsync(options?: PickerOptions & { signal?: AbortSignal }): Promise<string | null>;
+
+  /**
+   * Show a folder picker dialog without blocking the Node event loop
+   * @param options Picker options
+   * @returns Resolves with the selection, or null if cancelled
+   */
+  pickFolderAsync(options?: PickerOptions & { signal?: AbortSignal }): Promise<string | null>;
+
+  /**
+   * Show a multi-file picker dialog without blocking the Node event loop
+   * @param options Picker options
+   * @returns Resolves with the selection, or null if cancelled
+   */
+  pickFilesAsync(options?: PickerOptions & { signal?: AbortSignal }): Promise<string[] | null>;
+
+  /**
+   * Show a multi-folder picker dialog without blocking the Node event loop
+   * @param options Picker options
+   * @returns Resolves with the selection, or null if cancelled
+   */
+  pickFoldersAsync(options?: PickerOptions & { signal?: AbortSignal }): Promise<string[] | null>;
+
   /**
    * Underlying native binding handle
    */
@@ -836,12 +1197,177 @@ export class PDF {
    */
   save(options?: PrintSettings): void;
 
+  /**
+   * Queue a PDF export and return a promise
+   * The page prints on the UI thread, which is the JS thread, so JS pauses while each page renders; waiting for and
+   * reading back the result happen off-thread. A file is written next to `file` and renamed into place once complete
+   * Exports from all webviews are queued and pipelined: rendering is sequential, reading back overlaps
+   * @param options Print settings; omit `file` to receive the PDF in memory
+   * @returns The written file path, or the PDF bytes when no `file` was given
+   */
+  saveAsync(options: PrintSettings & { file: string }): Promise<string>;
+  saveAsync(options?: Omit<PrintSettings, "file">): Promise<Buffer>;
+
   /**
    * Underlying native binding handle
    */
   readonly native: unknown;
 }
 
+/**
+ * Options for a RenderPool
+ */
+export interface RenderPoolOptions {
+  /**
+   * Number of hidden webviews kept warm
+   * @default 2
+   */
+  size?: number;
+
+  /**
+   * Options passed to each pooled Webview
+   */
+  webview?: WebviewOptions;
+
+  /**
+   * Milliseconds to wait for a job's page to finish loading
+   * @default 30000
+   */
+  loadTimeout?: number;
+}
+
+/**
+ * A RenderPool job; exactly one of `html` or `url` is required
+ */
+export interface RenderJob {
+  /** HTML content to render */
+  html?: string;
+  /** URL to navigate to and render */
+  url?: string;
+  /** Files embedded for the duration of the job (see `Webview.embed`) */
+  embed?: Record<string, { content: string | Buffer; mime: string }>;
+  /** Settings for `PDF.saveAsync`; omit `file` to receive a Buffer */
+  pdfSettings?: PrintSettings;
+}
+
+/**
+ * RenderPool throughput and occupancy statistics
+ */
+export interface RenderPoolStats {
+  size: number;
+  idle: number;
+  pending: number;
+  completed: number;
+  failed: number;
+  elapsedMs: number;
+  jobsPerSecond: number;
+}
+
+/**
+ * Headless batch renderer - keeps hidden, pre-warmed webviews and renders jobs to PDF
+ */
+export class RenderPool {
+  /**
+   * Create a pool of hidden webviews
+   * @param app Application instance
+   * @param options Pool options
+   */
+  constructor(app: Application, options?: RenderPoolOptions);
+
+  /**
+   * Resolves once every pooled webview has loaded its blank page
+   * Rejects if a warm-up load fails or times out; that view still joins the pool
+   */
+  readonly ready: Promise<void>;
+
+  /**
+   * Render a job to PDF
+   * @returns The written file path, or the PDF bytes when `pdfSettings.file` is omitted
+   */
+  render(job: RenderJob): Promise<Buffer | string>;
+
+  /**
+   * Render several jobs, settling like Promise.allSettled
+   */
+  renderAll(jobs: RenderJob[]): Promise<PromiseSettledResult<Buffer | string>[]>;
+
+  /**
+   * Throughput and occupancy statistics
+   */
+  readonly stats: RenderPoolStats;
+
+  /**
+   * Reject pending jobs and close every pooled webview
+   * Jobs still loading reject; an export already running settles with its own result
+   * before its view is closed. Resolves once every view has been closed
+   */
+  close(): Promise<void>;
+}
+
+/**
+ * Options for a WebviewPool
+ */
+export interface WebviewPoolOptions {
+  /**
+   * Number of hidden webviews kept ready
+   * @default 2
+   */
+  size?: number;
+
+  /**
+   * Options passed to each pooled Webview
+   */
+  prefs?: WebviewOptions;
+
+  /**
+   * Milliseconds to wait for a pooled webview's warm-up load
+   * @default 30000
+   */
+  loadTimeout?: number;
+}
+
+/**
+ * WebviewPool occupancy statistics
+ */
+export interface WebviewPoolStats {
+  /** Target number of ready webviews */
+  size: number;
+  /** Webviews currently ready to acquire */
+  available: number;
+  /** Total acquire() calls */
+  acquired: number;
+  /** acquire() calls that had to create a webview synchronously */
+  misses: number;
+}
+
+/**
+ * Pool of hidden, pre-created webviews that refills in the background
+ * A webview becomes available once its blank warm-up page has finished loading
+ */
+export class WebviewPool {
+  /**
+   * Create a pool of hidden webviews
+   * @param app Application instance
+   * @param options Pool options
+   */
+  constructor(app: Application, options?: WebviewPoolOptions);
+
+  /**
+   * Take a hidden webview from the pool, creating one synchronously if none is ready
+   */
+  acquire(): Webview;
+
+  /**
+   * Occupancy statistics
+   */
+  readonly stats: WebviewPoolStats;
+
+  /**
+   * Stop refilling and close every webview still held by the pool
+   */
+  close(): void;
+}
+
 /**
  * Type schema for RPC parameters and return types
  */
@@ -1042,6 +1568,16 @@ export function createRPC(webview: Webview): SmartviewRPC;
 // Premium Features
 // ============================================================================
 
+/**
+ * Raw clipboard image
+ */
+export interface ClipboardImageRGBA {
+  width: number;
+  height: number;
+  /** width * height * 4 bytes, row-major RGBA */
+  data: Buffer;
+}
+
 /**
  * Clipboard API for reading and writing to the system clipboard
  */
@@ -1052,6 +1588,24 @@ export interface ClipboardAPI {
    */
   readText(): string;
 
+  /**
+   * Read text from the clipboard without blocking while the clipboard owner responds
+   * @returns The clipboard text content
+   */
+  readTextAsync(): Promise<string>;
+
+  /**
+   * Read an image from the clipboard without blocking while the clipboard owner responds
+   * @returns PNG data, or null if the clipboard holds no image
+   */
+  readImageAsync(options?: { format?: "png" }): Promise<Buffer | null>;
+
+  /**
+   * Read an image as raw, tightly packed 8-bit RGBA pixels (skips PNG encoding, Linux only)
+   * @returns Pixel data, or null if the clipboard holds no image
+   */
+  readImageAsync(options: { format: "rgba" }): Promise<ClipboardImageRGBA | null>;
+
   /**
    * Write text to the clipboard
    * @param text Text to write
@@ -1086,6 +1640,10 @@ export interface NotificationOptions {
   body?: string;
   /** Path to notification icon */
   icon?: string;
+  /** Called with the action key when the notification is clicked (Linux) */
+  onClick?: (action: string) => void;
+  /** Called with the freedesktop close reason when the notification goes away (Linux); reason 4 if it never reports closing within 10 minutes */
+  onClose?: (reason: number) => void;
 }
 
 /**
@@ -1104,12 +1662,17 @@ export class Notification {
   constructor(options?: NotificationOptions);
 
   /**
-   * Show the notification
+   * Show the notification, or update it in place if it was already shown
+   * On Linux, bursts are rate limited and queued updates to the same notification are coalesced
+   * Resolves null when there is no D-Bus session bus or notification server, or when the rate limiter drops the entry
+   * @param options Optional new title, body or icon
+   * @returns The server-assigned notification id, or null where the platform has none
    */
-  show(): void;
+  show(options?: Pick<NotificationOptions, "title" | "body" | "icon">): Promise<number | null>;
 
   /**
    * Check if notifications are supported on this platform
+   * Never blocks; on Linux it reports the D-Bus server probe once that has answered, and whether a session bus is reachable before that
    */
   static isSupported(): boolean;
 
@@ -1201,6 +1764,8 @@ declare const _default: {
   Stash: typeof Stash;
   Desktop: typeof Desktop;
   PDF: typeof PDF;
+  RenderPool: typeof RenderPool;
+  WebviewPool: typeof WebviewPool;
   SmartviewRPC: typeof SmartviewRPC;
   Types: typeof Types;
   createRPC: typeof createRPC;
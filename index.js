@@ -1,4 +1,10 @@
+import { Worker } from "node:worker_threads";
 import { native } from "./lib/native-loader.js";
+import { BINARY_BRIDGE_SCRIPT } from "./lib/binary-bridge.js";
+import { RPC_BATCH_MODES, rpcBatchingScript } from "./lib/rpc-batching.js";
+import { settleRpc } from "./lib/rpc-settle.js";
+
+native.Webview.setRpcSettle(settleRpc);
 
 let activeApp = null;
 
@@ -71,27 +77,62 @@ export class Application {
 
   /**
    * Run the application event loop
-   * Note: In Node.js bindings, this is automatically handled by libuv integration
+   * Note: By default this is handled by the libuv integration and resolves immediately.
+   * With `loop: "native"` it hands the main thread to saucer's native loop (Node timers and
+   * I/O keep running from it) and resolves once the application quits.
+   * @returns {Promise<void>}
    */
   run() {
-    this._native.run();
+    return this._native.run();
   }
 
   /**
-   * Post a callback to run on the main thread
+   * Post a callback to run on the main thread. A post with a `key` replaces the pending
+   * post queued under the same key, if any.
    * @param {Function} callback
+   * @param {{priority?: "user-blocking"|"normal"|"background", key?: string}} [options]
+   */
+  post(callback, options = {}) {
+    this._native.post(callback, options);
+  }
+
+  /**
+   * Drop the pending post() queued under `key`
+   * @param {string} key
+   * @returns {boolean} Whether a pending callback was removed
    */
-  post(callback) {
-    this._native.post(callback);
+  cancel(key) {
+    return this._native.cancel(key);
   }
 
   /**
    * Run the callback on the UI thread and resolve with its return value
    * @param {Function} callback
+   * @param {{priority?: "user-blocking"|"normal"|"background"}} [options]
    * @returns {Promise<*>}
    */
-  dispatch(callback) {
-    return this._native.dispatch(callback);
+  dispatch(callback, options = {}) {
+    return this._native.dispatch(callback, options);
+  }
+
+  /**
+   * Run the callback once the UI loop is idle (no pending UI events or post/dispatch work),
+   * like requestIdleCallback. It receives `{ didTimeout, timeRemaining() }`.
+   * @param {(deadline: {didTimeout: boolean, timeRemaining: () => number}) => void} callback
+   * @param {{timeout?: number}} [options] Run after this many milliseconds even if never idle
+   * @returns {number} Handle for cancelIdle()
+   */
+  requestIdle(callback, options = {}) {
+    return this._native.requestIdle(callback, options);
+  }
+
+  /**
+   * Cancel a callback queued with requestIdle()
+   * @param {number} handle
+   * @returns {boolean} Whether a pending callback was removed
+   */
+  cancelIdle(handle) {
+    return this._native.cancelIdle(handle);
   }
 
   /**
@@ -120,6 +161,187 @@ export class Application {
     return this._native.make(factory);
   }
 
+  /**
+   * Create a pool of hidden, pre-created webviews that can be acquired instantly
+   * @param {{size?: number, prefs?: Object}} [options]
+   * @returns {WebviewPool}
+   */
+  createWebviewPool(options = {}) {
+    return new WebviewPool(this, options);
+  }
+
+  /**
+   * Native startup milestones, in milliseconds since `performance.timeOrigin`.
+   * Each milestone is recorded once (the first application / webview / page).
+   * @param {{format?: "object"|"trace"}} [options] - "trace" returns Chrome trace-event JSON
+   * @returns {{complete: boolean, marks: Array<{name: string, start: number, duration: number}>}|string}
+   */
+  getStartupTimeline(options = {}) {
+    const timeline = this._native.getStartupTimeline();
+    const offset = timeline.origin - performance.timeOrigin;
+
+    const marks = timeline.marks.map((mark) => ({
+      name: mark.name,
+      start: mark.start + offset,
+      duration: mark.duration,
+    }));
+
+    if (options.format !== "trace") {
+      return { complete: timeline.complete, marks };
+    }
+
+    const traceEvents = marks.map((mark) => ({
+      name: mark.name,
+      cat: "startup",
+      ph: mark.duration > 0 ? "X" : "i",
+      ts: Math.round(mark.start * 1000),
+      ...(mark.duration > 0 ? { dur: Math.round(mark.duration * 1000) } : { s: "p" }),
+      pid: process.pid,
+      tid: 0,
+    }));
+
+    return JSON.stringify({ traceEvents, displayTimeUnit: "ms" });
+  }
+
+  /**
+   * Start the native tracer. Spans are recorded for loop iterations, TSFN hops
+   * (post/dispatch/pool/events/RPC), exposed RPC calls, evaluate round trips and
+   * scheme requests into per-thread ring buffers. Restarting discards the previous trace.
+   * @param {{eventsPerThread?: number}} [options] - Ring buffer size per thread (default 16384)
+   * @returns {boolean} false when the addon was built without tracing support
+   */
+  startTracing(options = {}) {
+    return this._native.startTracing(options);
+  }
+
+  /**
+   * Stop the native tracer and return the recorded spans
+   * @returns {string} Chrome trace-event JSON (open in chrome://tracing or ui.perfetto.dev)
+   */
+  stopTracing() {
+    return this._native.stopTracing();
+  }
+
+  /**
+   * Snapshot of the always-on native metrics. Latencies are in milliseconds and
+   * summarized from log-linear histograms (~12.5% precision).
+   * @returns {{loop: Object, queues: Object, tsfn: Object, rpc: Object, schemes: Object, evaluate: Object}}
+   */
+  metrics() {
+    return this._native.metrics();
+  }
+
+  /**
+   * Advance saucer's loop explicitly. Requires `Application.init({ loop: "manual" })`.
+   * Callbacks released to JS during the step run once control returns to the Node loop.
+   * @param {{maxIterations?: number, untilIdle?: boolean, timeoutMs?: number}} [options]
+   * @returns {{iterations: number, tasks: number, callbacks: number, elapsed: number, idle: boolean}}
+   */
+  step(options = {}) {
+    return this._native.step(options);
+  }
+
+  /**
+   * Watch for stalls: periods where the Node/UI thread stops pumping saucer for longer than
+   * `thresholdMs` (a long-running handler freezes the UI). Each stall emits a "stall" event with
+   * `{ duration, startedAt, stack }` once the loop recovers. `captureStack` (off by default)
+   * samples the blocked JS stack from a worker through the inspector (enables the debugger on the main thread).
+   * @param {{thresholdMs?: number, captureStack?: boolean}} [options]
+   */
+  startStallWatchdog(options = {}) {
+    const { thresholdMs = 100, captureStack = false } = options;
+    this.stopStallWatchdog();
+
+    const stacks = new Map();
+    const pending = new Map();
+    const emit = (stall) => {
+      for (const listener of this._stallListeners ?? []) {
+        listener(stall);
+      }
+    };
+
+    if (captureStack) {
+      this._stallSampler = new Worker(new URL("./lib/stall-sampler.js", import.meta.url));
+      this._stallSampler.unref();
+      this._stallSampler.on("message", ({ id, stack }) => {
+        const stall = pending.get(id);
+        if (!stall) {
+          stacks.set(id, stack);
+          return;
+        }
+        pending.delete(id);
+        clearTimeout(stall.timer);
+        emit({ ...stall.info, stack });
+      });
+    }
+
+    this._native.startStallWatchdog({ thresholdMs }, ({ id, ...info }) => {
+      if (!captureStack) {
+        emit({ ...info, stack: null });
+        return;
+      }
+
+      if (stacks.has(id)) {
+        const stack = stacks.get(id);
+        stacks.delete(id);
+        emit({ ...info, stack });
+        return;
+      }
+
+      // The sampler's message can trail the native report; don't hold the event for long
+      const timer = setTimeout(() => {
+        pending.delete(id);
+        emit({ ...info, stack: null });
+      }, 100);
+      timer.unref();
+      pending.set(id, { info, timer });
+    });
+  }
+
+  /**
+   * Stop the stall watchdog (and its stack sampler)
+   */
+  stopStallWatchdog() {
+    this._native.stopStallWatchdog();
+    if (this._stallSampler) {
+      this._stallSampler.postMessage("close");
+      this._stallSampler = null;
+    }
+  }
+
+  /**
+   * Listen for application events. Supported: "stall" (see startStallWatchdog)
+   * @param {"stall"} event
+   * @param {(stall: {duration: number, startedAt: number, stack: Array|null}) => void} listener
+   */
+  on(event, listener) {
+    if (event !== "stall") {
+      throw new Error(`Unsupported event: ${event}`);
+    }
+    if (typeof listener !== "function") {
+      throw new TypeError("Listener must be a function");
+    }
+    (this._stallListeners ??= new Set()).add(listener);
+    return this;
+  }
+
+  /**
+   * Remove an application event listener
+   * @param {"stall"} event
+   * @param {Function} [listener] - omit to remove all listeners for the event
+   */
+  off(event, listener) {
+    if (event !== "stall" || !this._stallListeners) {
+      return this;
+    }
+    if (listener) {
+      this._stallListeners.delete(listener);
+    } else {
+      this._stallListeners.clear();
+    }
+    return this;
+  }
+
   /**
    * Get the native application handle (unsafe)
    * @returns {*}
@@ -162,9 +384,19 @@ export class Webview {
     if (!(app instanceof Application)) {
       throw new TypeError("First argument must be an Application instance");
     }
+    if (options.rpcBatching !== undefined && !RPC_BATCH_MODES.includes(options.rpcBatching)) {
+      throw new TypeError(`rpcBatching must be one of: ${RPC_BATCH_MODES.join(", ")}`);
+    }
     this._native = new native.Webview(app._native, options);
     this._parent = app;
     this._messageHandler = null;
+
+    // Page side of the compact Buffer/TypedArray encoding used by evaluate/execute/expose
+    this._native.inject({ code: BINARY_BRIDGE_SCRIPT, time: "creation", permanent: true });
+
+    if (options.rpcBatching) {
+      this._native.inject({ code: rpcBatchingScript(options.rpcBatching), time: "creation", permanent: true });
+    }
   }
 
   // ========================================================================
@@ -361,6 +593,29 @@ export class Webview {
     this._native.zoom = value;
   }
 
+  /**
+   * Read position, size, fullscreen/maximized/minimized state and zoom in a single native call
+   * @returns {{x: number, y: number, width: number, height: number, fullscreen: boolean, maximized: boolean, minimized: boolean, zoom: number}}
+   */
+  getGeometry() {
+    return this._native.getGeometry();
+  }
+
+  /**
+   * Set several window/webview properties in one native call.
+   * The whole object is validated first (unknown keys and bad values throw a TypeError without applying
+   * anything). `visible` is applied after geometry and before maximized/fullscreen/minimized, which
+   * need a shown window on some platforms.
+   * @param {{title?: string, size?: {width: number, height: number}, minSize?: {width: number, height: number},
+   *   maxSize?: {width: number, height: number}, position?: {x: number, y: number}, resizable?: boolean,
+   *   decorations?: boolean, alwaysOnTop?: boolean, clickThrough?: boolean, maximized?: boolean,
+   *   minimized?: boolean, fullscreen?: boolean, visible?: boolean, backgroundColor?: number[], zoom?: number,
+   *   devTools?: boolean, contextMenu?: boolean, forceDarkMode?: boolean}} properties
+   */
+  apply(properties) {
+    this._native.apply(properties);
+  }
+
   // ========================================================================
   // Webview Properties
   // ========================================================================
@@ -551,7 +806,10 @@ export class Webview {
    * Expose a Node-side function to the webview (Smartview RPC)
    * @param {string} name - Function name to expose
    * @param {Function} handler - Handler invoked from the webview
-   * @param {{async?: boolean, launch?: 'sync' | 'async'}} [options]
+   * @param {{async?: boolean, launch?: 'sync' | 'async', raw?: boolean | 'buffer'}} [options]
+   *   With `raw`, the handler gets the arguments as one unparsed JSON array string (or Buffer)
+   *   and a string/Buffer result is sent back as pre-serialized JSON (a result that isn't valid
+   *   JSON rejects the call). `raw` cannot be combined with `launch`/`async`
    */
   expose(name, handler, options = {}) {
     this._native.expose(name, handler, options);
@@ -702,7 +960,8 @@ export class Webview {
  */
 export class Stash {
   /**
-   * Create a Stash from a Buffer (copies the data)
+   * Create a Stash from a Buffer (copies the data).
+   * Identical contents are deduplicated into one refcounted, process-wide copy.
    * @param {Buffer} buffer - Source buffer
    * @returns {Stash|null}
    */
@@ -727,6 +986,14 @@ export class Stash {
     return stash;
   }
 
+  /**
+   * Statistics for the process-wide shared stash store (used by `Stash.from` and `webview.embed`)
+   * @returns {{entries: number, bytes: number}}
+   */
+  static sharedStats() {
+    return native.Stash.sharedStats();
+  }
+
   /**
    * Get the size of the stash in bytes
    * @type {number}
@@ -874,6 +1141,58 @@ export class Desktop {
     return this._native.pickFolders(options);
   }
 
+  /**
+   * Show a file picker dialog without blocking the Node event loop
+   * @param {{initial?: string, filters?: string[], signal?: AbortSignal}} [options] - Picker options; aborting closes the dialog
+   * @returns {Promise<string|null>} - Resolves with the selection, or null if cancelled
+   */
+  pickFileAsync(options) {
+    return this._pickAsync("pickFileAsync", options);
+  }
+
+  /**
+   * Show a folder picker dialog without blocking the Node event loop
+   * @param {{initial?: string, signal?: AbortSignal}} [options] - Picker options; aborting closes the dialog
+   * @returns {Promise<string|null>} - Resolves with the selection, or null if cancelled
+   */
+  pickFolderAsync(options) {
+    return this._pickAsync("pickFolderAsync", options);
+  }
+
+  /**
+   * Show a multi-file picker dialog without blocking the Node event loop
+   * @param {{initial?: string, filters?: string[], signal?: AbortSignal}} [options] - Picker options; aborting closes the dialog
+   * @returns {Promise<string[]|null>} - Resolves with the selection, or null if cancelled
+   */
+  pickFilesAsync(options) {
+    return this._pickAsync("pickFilesAsync", options);
+  }
+
+  /**
+   * Show a multi-folder picker dialog without blocking the Node event loop
+   * @param {{initial?: string, signal?: AbortSignal}} [options] - Picker options; aborting closes the dialog
+   * @returns {Promise<string[]|null>} - Resolves with the selection, or null if cancelled
+   */
+  pickFoldersAsync(options) {
+    return this._pickAsync("pickFoldersAsync", options);
+  }
+
+  /** @private */
+  _pickAsync(method, options = {}) {
+    const { signal, ...rest } = options;
+    if (signal?.aborted) {
+      return Promise.resolve(null);
+    }
+
+    const { promise, cancel } = this._native[method](rest);
+    if (!signal) {
+      return promise;
+    }
+
+    signal.addEventListener("abort", cancel, { once: true });
+    return promise.finally(() => signal.removeEventListener("abort", cancel));
+  }
+
   /**
    * Get the native desktop handle (unsafe)
    * @returns {*}
@@ -906,6 +1225,19 @@ export class PDF {
     this._native.save(options);
   }
 
+  /**
+   * Queue a PDF export and return a promise. The page prints on the UI thread, which is the JS
+   * thread, so JS pauses while each page renders; waiting for and reading back the result happen
+   * off-thread. A file is written next to `file` and renamed into place once complete.
+   * Exports from all webviews share one queue: they render one after another while finished
+   * buffers are read back in parallel. Without `file` the PDF is returned as a Buffer.
+   * @param {{file?: string, orientation?: 'portrait'|'landscape', width?: number, height?: number}} [options] - Print settings
+   * @returns {Promise<string|Buffer>} The written file path, or the PDF bytes when no `file` was given
+   */
+  saveAsync(options) {
+    return this._native.saveAsync(options);
+  }
+
   /**
    * Get the native PDF handle (unsafe)
    * @returns {*}
@@ -915,6 +1247,370 @@ export class PDF {
   }
 }
 
+const BLANK_PAGE = "<!doctype html><html><body></body></html>";
+
+/**
+ * Start a page load and wait for the webview's "finished" load event.
+ * Shared by the pools for warm-up loads and RenderPool jobs.
+ * @param {Webview} webview
+ * @param {() => void} start - Starts the load (loadHtml, navigate, ...)
+ * @param {number} timeout - Milliseconds before the load is given up on
+ * @returns {{promise: Promise<void>, cancel: (error: Error) => void}}
+ */
+const loadPage = (webview, start, timeout) => {
+  let cancel;
+
+  const promise = new Promise((resolve, reject) => {
+    let settled = false;
+
+    const settle = (error) => {
+      if (settled) return;
+      settled = true;
+      clearTimeout(timer);
+      webview.off("load", onLoad);
+      if (error) reject(error);
+      else resolve();
+    };
+
+    const onLoad = (state) => {
+      if (state === "finished") settle();
+    };
+
+    const timer = setTimeout(() => {
+      settle(new Error(`Page did not finish loading within ${timeout}ms`));
+    }, timeout);
+
+    // The timeout only guards the load; it should not keep the process alive by itself
+    timer.unref?.();
+
+    cancel = settle;
+    webview.on("load", onLoad);
+    start();
+  });
+
+  return { promise, cancel };
+};
+
+/**
+ * Headless batch renderer - keeps a pool of hidden, pre-warmed webviews and turns
+ * `{ html | url, pdfSettings }` jobs into PDFs. Views are reused between jobs.
+ *
+ * @example
+ * const pool = new RenderPool(app, { size: 4 });
+ * await pool.ready;
+ * const pdf = await pool.render({ html: "<h1>Report</h1>" }); // Buffer
+ * console.log(pool.stats.jobsPerSecond);
+ * pool.close();
+ */
+export class RenderPool {
+  /**
+   * @param {Application} app - Application instance
+   * @param {{size?: number, webview?: Object, loadTimeout?: number}} [options]
+   *   - size: Number of hidden webviews to keep warm (default 2)
+   *   - webview: Options passed to each pooled Webview
+   *   - loadTimeout: Milliseconds to wait for a job's page to finish loading (default 30000)
+   */
+  constructor(app, options = {}) {
+    if (!(app instanceof Application)) {
+      throw new TypeError("First argument must be an Application instance");
+    }
+
+    const size = Math.max(1, Math.floor(options.size ?? 2));
+
+    this._loadTimeout = options.loadTimeout ?? 30000;
+    this._views = [];
+    this._idle = [];
+    this._queue = [];
+    this._closed = false;
+    this._closing = null;
+    this._completed = 0;
+    this._failed = 0;
+    this._startedAt = null;
+
+    for (let i = 0; i < size; i++) {
+      const webview = new Webview(app, options.webview ?? {});
+      this._views.push({ webview, pdf: new PDF(webview), cancelLoad: null, running: null });
+    }
+
+    /**
+     * Resolves once every pooled webview has loaded its blank page. A view whose warm-up
+     * fails still joins the pool; its first job loads its own page anyway.
+     * @type {Promise<void>}
+     */
+    this.ready = Promise.all(
+      this._views.map((view) =>
+        this._load(view, () => view.webview.loadHtml(BLANK_PAGE)).finally(() => {
+          this._release(view);
+        }),
+      ),
+    ).then(() => undefined);
+
+    // close() may cancel the warm-up; callers that never await `ready` should not see that as unhandled
+    this.ready.catch(() => {});
+  }
+
+  /**
+   * Render a job to PDF
+   * @param {{html?: string, url?: string, embed?: Object, pdfSettings?: Object}} job
+   *   - html / url: Page content to render (exactly one is required)
+   *   - embed: Files to embed for the duration of the job (see `Webview.embed`)
+   *   - pdfSettings: Options for `PDF.saveAsync`; omit `file` to receive a Buffer
+   * @returns {Promise<Buffer|string>}
+   */
+  render(job) {
+    if (this._closed) {
+      return Promise.reject(new Error("RenderPool is closed"));
+    }
+
+    if (!job || (typeof job.html !== "string") === (typeof job.url !== "string")) {
+      return Promise.reject(new TypeError("RenderPool job requires exactly one of `html` or `url`"));
+    }
+
+    return new Promise((resolve, reject) => {
+      this._queue.push({ job, resolve, reject });
+      this._drain();
+    });
+  }
+
+  /**
+   * Render several jobs, settling like Promise.allSettled
+   * @param {Array<Object>} jobs
+   * @returns {Promise<Array<{status: string, value?: Buffer|string, reason?: Error}>>}
+   */
+  renderAll(jobs) {
+    return Promise.allSettled(jobs.map((job) => this.render(job)));
+  }
+
+  /**
+   * Throughput and occupancy statistics
+   * @type {{size: number, idle: number, pending: number, completed: number, failed: number, elapsedMs: number, jobsPerSecond: number}}
+   */
+  get stats() {
+    const elapsedMs = this._startedAt === null ? 0 : Date.now() - this._startedAt;
+    return {
+      size: this._views.length,
+      idle: this._idle.length,
+      pending: this._queue.length,
+      completed: this._completed,
+      failed: this._failed,
+      elapsedMs,
+      jobsPerSecond: elapsedMs > 0 ? (this._completed * 1000) / elapsedMs : 0,
+    };
+  }
+
+  /**
+   * Reject pending jobs and close every pooled webview. Jobs already loading reject;
+   * an export already running settles with its own result before its view is closed.
+   * @returns {Promise<void>} - Resolves once every view has been closed
+   */
+  close() {
+    if (this._closed) return this._closing;
+    this._closed = true;
+
+    for (const entry of this._queue.splice(0)) {
+      entry.reject(new Error("RenderPool is closed"));
+    }
+
+    this._closing = Promise.all(
+      this._views.map((view) => {
+        view.cancelLoad?.(new Error("RenderPool is closed"));
+        return Promise.resolve(view.running).then(() => view.webview.close());
+      }),
+    ).then(() => undefined);
+
+    this._idle = [];
+    return this._closing;
+  }
+
+  _release(view) {
+    if (this._closed) return;
+    this._idle.push(view);
+    this._drain();
+  }
+
+  _drain() {
+    while (this._idle.length > 0 && this._queue.length > 0) {
+      const view = this._idle.shift();
+      const entry = this._queue.shift();
+
+      if (this._startedAt === null) {
+        this._startedAt = Date.now();
+      }
+
+      view.running = this._run(view, entry).finally(() => {
+        view.running = null;
+      });
+    }
+  }
+
+  _load(view, start) {
+    const load = loadPage(view.webview, start, this._loadTimeout);
+    view.cancelLoad = load.cancel;
+    return load.promise.finally(() => {
+      view.cancelLoad = null;
+    });
+  }
+
+  async _run(view, { job, resolve, reject }) {
+    const { webview, pdf } = view;
+
+    try {
+      if (job.embed) {
+        webview.embed(job.embed);
+      }
+
+      await this._load(view, () => {
+        if (typeof job.html === "string") {
+          webview.loadHtml(job.html);
+        } else {
+          webview.navigate(job.url);
+        }
+      });
+
+      const result = await pdf.saveAsync(job.pdfSettings ?? {});
+      this._completed++;
+      resolve(result);
+    } catch (error) {
+      this._failed++;
+      reject(error);
+    } finally {
+      // Reset the view so the next job starts from a clean page; close() already closed it otherwise
+      if (!this._closed) {
+        webview.clearScripts();
+        webview.clearEmbedded();
+        this._release(view);
+      }
+    }
+  }
+}
+
+/**
+ * Pool of hidden, pre-created webviews for windows that must open instantly.
+ * Creating a Webview spawns the native window and web process, which can take
+ * hundreds of milliseconds; `acquire()` hands out a warm one and refills the
+ * pool in the background, one webview at a time. A webview only becomes
+ * available once its blank warm-up page has finished loading.
+ *
+ * @example
+ * const pool = app.createWebviewPool({ size: 2, prefs: { hardwareAcceleration: true } });
+ * const popup = pool.acquire();
+ * popup.loadHtml("<h1>Details</h1>");
+ * popup.show();
+ */
+export class WebviewPool {
+  /**
+   * @param {Application} app - Application instance
+   * @param {{size?: number, prefs?: Object, loadTimeout?: number}} [options]
+   *   - size: Number of hidden webviews to keep ready (default 2)
+   *   - prefs: Options passed to each pooled Webview
+   *   - loadTimeout: Milliseconds to wait for a warm-up load (default 30000)
+   */
+  constructor(app, options = {}) {
+    if (!(app instanceof Application)) {
+      throw new TypeError("First argument must be an Application instance");
+    }
+
+    this._app = app;
+    this._size = Math.max(0, Math.floor(options.size ?? 2));
+    this._prefs = options.prefs ?? {};
+    this._loadTimeout = options.loadTimeout ?? 30000;
+    this._idle = [];
+    this._refill = null;
+    this._warming = null;
+    this._closed = false;
+    this._acquired = 0;
+    this._misses = 0;
+
+    this._schedule();
+  }
+
+  /**
+   * Take a webview from the pool. Falls back to creating one synchronously
+   * when the pool is empty. The webview stays hidden until shown.
+   * @returns {Webview}
+   */
+  acquire() {
+    if (this._closed) {
+      throw new Error("WebviewPool is closed");
+    }
+
+    this._acquired++;
+
+    let webview = this._idle.shift();
+    if (!webview) {
+      this._misses++;
+      webview = new Webview(this._app, this._prefs);
+    }
+
+    this._schedule();
+    return webview;
+  }
+
+  /**
+   * Pool occupancy statistics
+   * @type {{size: number, available: number, acquired: number, misses: number}}
+   */
+  get stats() {
+    return {
+      size: this._size,
+      available: this._idle.length,
+      acquired: this._acquired,
+      misses: this._misses,
+    };
+  }
+
+  /**
+   * Stop refilling and close every webview still held by the pool
+   */
+  close() {
+    if (this._closed) return;
+    this._closed = true;
+
+    if (this._refill) {
+      clearImmediate(this._refill);
+      this._refill = null;
+    }
+
+    if (this._warming) {
+      this._warming.cancel(new Error("WebviewPool is closed"));
+      this._warming.webview.close();
+      this._warming = null;
+    }
+
+    for (const webview of this._idle.splice(0)) {
+      webview.close();
+    }
+  }
+
+  _schedule() {
+    if (this._closed || this._refill || this._warming || this._idle.length >= this._size) return;
+
+    // Create one webview per turn so a refill never blocks the loop for long
+    this._refill = setImmediate(() => {
+      this._refill = null;
+      if (this._closed || this._idle.length >= this._size) return;
+
+      // Load an empty document so the web process is up before the view is handed out
+      const webview = new Webview(this._app, this._prefs);
+      const warming = { webview, ...loadPage(webview, () => webview.loadHtml(BLANK_PAGE), this._loadTimeout) };
+      this._warming = warming;
+
+      // A warm-up that fails or times out still leaves a usable webview
+      warming.promise
+        .catch(() => {})
+        .then(() => {
+          if (this._warming !== warming) return;
+          this._warming = null;
+          this._idle.push(webview);
+          this._schedule();
+        });
+    });
+
+    // A pending refill should not keep the process alive on its own
+    this._refill.unref?.();
+  }
+}
+
 /**
  * Type schema builders for SmartviewRPC
  * Used to define parameter and return types for exposed functions
@@ -1372,6 +2068,8 @@ export default {
   Stash,
   Desktop,
   PDF,
+  RenderPool,
+  WebviewPool,
   SmartviewRPC,
   Types,
   createRPC,
@@ -0,0 +1,102 @@
+/**
+ * Page side of the binary transfer encoding
+ *
+ * Binary values cross the JSON bridge as base64 under a single-key tag,
+ * `{ "$saucer_binary": "<base64>" }`. Node encodes and decodes them with Buffer's
+ * base64 codec, this script does the same in the page:
+ *
+ * - evaluate() results and `window.saucer.exposed.*` arguments are tagged at any depth
+ *   on the way out and arrive in Node as Buffers. Only the values the bridge serializes
+ *   are tagged (copies, the page's objects and global prototypes are left alone)
+ * - evaluate()/execute() arguments that carry tags are substituted as
+ *   `window.__saucerBinary.revive(...)` and become Uint8Arrays
+ * - results of `window.saucer.exposed.*` calls are revived into Uint8Arrays
+ *
+ * Injected into every webview at creation time (see Webview constructor).
+ */
+
+export const BINARY_TAG = "$saucer_binary";
+
+export const BINARY_BRIDGE_SCRIPT = `
+(() => {
+  if (window.__saucerBinary) return;
+
+  const TAG = ${JSON.stringify(BINARY_TAG)};
+
+  const decode = (text) => {
+    if (Uint8Array.fromBase64) return Uint8Array.fromBase64(text);
+    const bytes = atob(text);
+    const out = new Uint8Array(bytes.length);
+    for (let i = 0; i < bytes.length; i++) out[i] = bytes.charCodeAt(i);
+    return out;
+  };
+
+  const encode = (bytes) => {
+    if (bytes.toBase64) return bytes.toBase64();
+    let text = "";
+    for (let i = 0; i < bytes.length; i += 0x8000) {
+      text += String.fromCharCode.apply(null, bytes.subarray(i, i + 0x8000));
+    }
+    return btoa(text);
+  };
+
+  // Containers are copied only along the paths that hold binary values
+  const tag = (value) => {
+    if (value === null || typeof value !== "object") return value;
+    if (value instanceof ArrayBuffer) return { [TAG]: encode(new Uint8Array(value)) };
+    if (ArrayBuffer.isView(value)) return { [TAG]: encode(new Uint8Array(value.buffer, value.byteOffset, value.byteLength)) };
+    if (typeof value.toJSON === "function") return value;
+
+    let copy = null;
+    for (const key of Object.keys(value)) {
+      const item = value[key];
+      const tagged = tag(item);
+      if (tagged !== item) {
+        copy ??= Array.isArray(value) ? value.slice() : { ...value };
+        copy[key] = tagged;
+      }
+    }
+    return copy ?? value;
+  };
+
+  // evaluate() results may be promises; saucer awaits what this returns
+  const tagResult = (value) => (value && typeof value.then === "function" ? Promise.resolve(value).then(tag) : tag(value));
+
+  const revive = (value) => {
+    if (value === null || typeof value !== "object" || ArrayBuffer.isView(value)) return value;
+    const keys = Object.keys(value);
+    if (keys.length === 1 && keys[0] === TAG && typeof value[TAG] === "string") return decode(value[TAG]);
+    for (const key of keys) value[key] = revive(value[key]);
+    return value;
+  };
+
+  // saucer's own script defines window.saucer.exposed; wrap it once it exists
+  const wrapExposed = () => {
+    const bridge = window.saucer;
+    if (!bridge || !bridge.exposed) return false;
+    if (bridge.exposed.__saucerBinary) return true;
+
+    const exposed = new Proxy(bridge.exposed, {
+      get(target, key) {
+        if (key === "__saucerBinary") return true;
+        const value = target[key];
+        if (typeof value !== "function") return value;
+        return (...args) => Promise.resolve(value.apply(target, tag(args))).then(revive);
+      },
+    });
+
+    try {
+      bridge.exposed = exposed;
+    } catch {
+      // Read-only binding: results keep their tagged form
+    }
+    return true;
+  };
+
+  if (!wrapExposed()) {
+    document.addEventListener("DOMContentLoaded", wrapExposed, { once: true });
+  }
+
+  window.__saucerBinary = { decode, encode, revive, tag: tagResult };
+})();
+`;
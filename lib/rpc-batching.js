@@ -0,0 +1,78 @@
+/**
+ * Page side of opt-in RPC batching (`new Webview(app, { rpcBatching })`)
+ *
+ * Calls to `window.saucer.exposed.*` made in the same microtask (or animation frame)
+ * are queued and sent as one `__saucer_batch([[name, args], ...])` message. The native
+ * demultiplexer dispatches each call and resolves the batch once with one
+ * `{ ok, value | error }` per call. A flush with a single call skips the batch wrapper.
+ */
+
+export const RPC_BATCH_MODES = ["microtask", "frame"];
+
+/**
+ * @param {"microtask" | "frame"} mode
+ * @returns {string}
+ */
+export function rpcBatchingScript(mode) {
+  const schedule = mode === "frame" ? "(flush) => requestAnimationFrame(() => flush())" : "queueMicrotask";
+
+  return `
+(() => {
+  if (window.__saucerBatching) return;
+  window.__saucerBatching = true;
+
+  const BATCH = "__saucer_batch";
+  const schedule = ${schedule};
+
+  const install = () => {
+    const bridge = window.saucer;
+    if (!bridge || !bridge.exposed) return false;
+
+    const inner = bridge.exposed;
+    let queue = null;
+
+    const flush = () => {
+      const calls = queue;
+      queue = null;
+
+      if (calls.length === 1) {
+        const [call] = calls;
+        Promise.resolve(inner[call.name](...call.args)).then(call.resolve, call.reject);
+        return;
+      }
+
+      inner[BATCH](calls.map((call) => [call.name, call.args])).then(
+        (results) => results.forEach((result, i) =>
+          result && result.ok ? calls[i].resolve(result.value) : calls[i].reject(result ? result.error : "RPC batch failed")),
+        (reason) => calls.forEach((call) => call.reject(reason)),
+      );
+    };
+
+    const exposed = new Proxy(inner, {
+      get(target, key) {
+        const value = target[key];
+        if (key === BATCH || typeof key !== "string" || typeof value !== "function") return value;
+        return (...args) => new Promise((resolve, reject) => {
+          if (!queue) {
+            queue = [];
+            schedule(flush);
+          }
+          queue.push({ name: key, args, resolve, reject });
+        });
+      },
+    });
+
+    try {
+      bridge.exposed = exposed;
+    } catch {
+      // Read-only binding: calls go out one by one
+    }
+    return true;
+  };
+
+  if (!install()) {
+    document.addEventListener("DOMContentLoaded", install, { once: true });
+  }
+})();
+`;
+}
@@ -0,0 +1,18 @@
+/**
+ * Settles the promise returned by an exposed handler
+ *
+ * The addon calls this with the handler's promise, the pooled call id and its two
+ * per-env trampolines, so the only per-call closures are the two arrows below.
+ */
+
+/**
+ * @param {Promise<unknown>} promise
+ * @param {number} id
+ * @param {(id: number, value: unknown) => void} ok
+ * @param {(id: number, reason: unknown) => void} fail
+ */
+export const settleRpc = (promise, id, ok, fail) =>
+  promise.then(
+    (value) => ok(id, value),
+    (reason) => fail(id, reason),
+  );
@@ -0,0 +1,55 @@
+/**
+ * Stall stack sampler (worker thread)
+ *
+ * Started by app.startStallWatchdog({ captureStack: true }). The native watchdog
+ * notifies this worker when the Node/UI thread stops pumping saucer; the worker then
+ * pauses the main thread through the inspector, records its JS call stack and resumes it.
+ */
+
+import { parentPort } from "node:worker_threads";
+import { Session } from "node:inspector";
+import { native } from "./native-loader.js";
+
+const session = new Session();
+session.connectToMainThread();
+session.post("Debugger.enable");
+
+let capturing = null;
+
+session.on("Debugger.paused", ({ params }) => {
+  const id = capturing;
+  capturing = null;
+
+  const stack = params.callFrames.map((frame) => ({
+    functionName: frame.functionName || "<anonymous>",
+    url: frame.url,
+    line: frame.location.lineNumber + 1,
+    column: frame.location.columnNumber + 1,
+  }));
+
+  session.post("Debugger.resume");
+
+  if (id === null) {
+    return;
+  }
+
+  // A pause that only landed after the loop recovered shows unrelated code
+  parentPort.postMessage({ id, stack: native.watchdog.active(id) ? stack : null });
+});
+
+native.watchdog.sample((id) => {
+  if (capturing !== null) {
+    parentPort.postMessage({ id, stack: null });
+    return;
+  }
+
+  capturing = id;
+  session.post("Debugger.pause");
+});
+
+parentPort.on("message", (message) => {
+  if (message === "close") {
+    session.disconnect();
+    process.exit(0);
+  }
+});
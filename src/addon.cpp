@@ -56,6 +56,24 @@
 
 #include <string>
 
+#include <deque>
+
+#include <filesystem>
+
+#include <fstream>
+
+#include <atomic>
+
+#include <optional>
+
+#include <thread>
+
+#include <array>
+
+#include <chrono>
+
+#include <string_view>
+
 
 
 #ifdef __APPLE__
@@ -67,6 +85,15 @@
 // Platform-specific premium features
 #include "platform.hpp"
 
+// Opt-in native tracer (Chrome trace-event output)
+#include "tracing.hpp"
+
+// Always-on counters and latency histograms (app.metrics())
+#include "metrics.hpp"
+
+// UI-thread stall watchdog ("stall" events)
+#include "watchdog.hpp"
+
 // Glaze v6.4 declares a generic fallback for convert_from_generic but does not
 // provide a direct generic_json -> generic_json definition in all toolchains.
 // MSVC can instantiate that unresolved path while parsing nested containers.
@@ -100,12 +127,128 @@ inline Napi::String CStrToJS(Napi::Env env, char* str) {
 
 
 
+// ============================================================================
+// StartupTimeline - First-occurrence timestamps from addon load to first paint
+// ============================================================================
+
+class StartupTimeline {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  // Record an instant; only the first mark with a given name is kept
+  static void Mark(const char* name) { Record(name, Clock::now(), Clock::duration::zero()); }
+
+  // Record a span covering the lifetime of the scope (first occurrence only)
+  class Span {
+  public:
+    explicit Span(const char* name) : name_(name), start_(Clock::now()) {}
+    ~Span() { StartupTimeline::Record(name_, start_, Clock::now() - start_); }
+
+  private:
+    const char* name_;
+    Clock::time_point start_;
+  };
+
+  // True once the first page has reached dom-ready; later webviews skip the native listeners
+  static bool Complete() { return complete_.load(std::memory_order_acquire); }
+
+  static Napi::Value ToJS(Napi::Env env);
+
+private:
+  struct Entry {
+    const char* name;
+    Clock::time_point start;
+    Clock::duration duration;
+  };
+
+  static void Record(const char* name, Clock::time_point start, Clock::duration duration);
+
+  static const Clock::time_point origin_;
+  static const std::chrono::system_clock::time_point origin_wall_;
+  static std::mutex mutex_;
+  static std::vector<Entry> entries_;
+  static std::atomic<bool> complete_;
+};
+
+const StartupTimeline::Clock::time_point StartupTimeline::origin_ = StartupTimeline::Clock::now();
+const std::chrono::system_clock::time_point StartupTimeline::origin_wall_ = std::chrono::system_clock::now();
+std::mutex StartupTimeline::mutex_;
+std::vector<StartupTimeline::Entry> StartupTimeline::entries_;
+std::atomic<bool> StartupTimeline::complete_{false};
+
+void StartupTimeline::Record(const char* name, Clock::time_point start, Clock::duration duration) {
+  if (Complete()) return;
+
+  std::scoped_lock lock(mutex_);
+  for (const auto& entry : entries_) {
+    if (std::string_view(entry.name) == name) return;
+  }
+
+  entries_.push_back({name, start, duration});
+
+  if (std::string_view(name) == "webview.dom-ready") {
+    complete_.store(true, std::memory_order_release);
+  }
+}
+
+Napi::Value StartupTimeline::ToJS(Napi::Env env) {
+  using Millis = std::chrono::duration<double, std::milli>;
+
+  std::vector<Entry> entries;
+  {
+    std::scoped_lock lock(mutex_);
+    entries = entries_;
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.start < b.start; });
+
+  Napi::Array marks = Napi::Array::New(env, entries.size());
+  for (size_t i = 0; i < entries.size(); i++) {
+    Napi::Object mark = Napi::Object::New(env);
+    mark.Set("name", entries[i].name);
+    mark.Set("start", Millis(entries[i].start - origin_).count());
+    mark.Set("duration", Millis(entries[i].duration).count());
+    marks.Set(static_cast<uint32_t>(i), mark);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("origin", Millis(origin_wall_.time_since_epoch()).count());
+  result.Set("complete", Complete());
+  result.Set("marks", marks);
+  return result;
+}
+
 // Forward declarations
 
 class Application;
 
 class Webview;
 
+// Per-env class constructors and helpers. lib/stall-sampler.js loads the addon again inside a worker,
+// so a constructor kept in a static would be overwritten with one from the worker's env
+struct PdfExportQueue;
+
+struct AddonData {
+  Napi::FunctionReference application;
+  Napi::FunctionReference stash;
+  Napi::FunctionReference icon;
+
+  // JSON.stringify replacer for binary values (see StringifyJson)
+  Napi::FunctionReference binary_replacer;
+
+  // Promise results of exposed handlers: lib/rpc-settle.js's helper and the two trampolines it calls back
+  Napi::FunctionReference rpc_settle;
+  Napi::FunctionReference rpc_resolve;
+  Napi::FunctionReference rpc_reject;
+
+  // PDF.saveAsync jobs; they hold deferreds and references, so they belong to the env that queued them
+  std::shared_ptr<PdfExportQueue> pdf_exports;
+};
+
+static AddonData& GetAddonData(Napi::Env env) {
+  return *env.GetInstanceData<AddonData>();
+}
+
 
 
 // ============================================================================
@@ -150,6 +293,44 @@ private:
 
   bool owns_app_handle_ = false;
 
+  // Who owns the main thread: the libuv hooks (default), saucer's native loop once run() is called,
+  // or nobody - in manual mode saucer only advances through step()
+  enum class LoopMode { Libuv, Native, Manual };
+
+  LoopMode loop_mode_ = LoopMode::Libuv;
+
+  bool native_loop_active_ = false;
+
+  // Set by quit() to end the native loop
+  bool native_quit_ = false;
+
+  // Active between native-loop waits so uv_run's poll phase doesn't block GLib out
+  uv_idle_t* idle_handle_ = nullptr;
+
+  std::shared_ptr<Napi::Promise::Deferred> run_deferred_;
+
+  Napi::ThreadSafeFunction run_tsfn_;
+
+  // Receives finished stalls from the watchdog thread
+  Napi::ThreadSafeFunction stall_tsfn_;
+
+  bool stall_watchdog_ = false;
+
+  // requestIdle() callbacks, in request order; only touched on the JS thread
+  struct IdleTask {
+    uint64_t id = 0;
+    Napi::FunctionReference callback;
+    uint64_t timeout = 0;  // steady clock ns after which the task runs even while busy, 0 = never
+  };
+
+  std::deque<std::shared_ptr<IdleTask>> idle_tasks_;
+
+  uint64_t next_idle_id_ = 0;
+
+  bool idle_pass_pending_ = false;
+
+  Napi::ThreadSafeFunction idle_tsfn_;
+
 
 
   // Methods
@@ -158,12 +339,14 @@ private:
 
   Napi::Value Quit(const Napi::CallbackInfo& info);
 
-  void Run(const Napi::CallbackInfo& info);
+  Napi::Value Run(const Napi::CallbackInfo& info);
 
   void Post(const Napi::CallbackInfo& info);
 
   Napi::Value Dispatch(const Napi::CallbackInfo& info);
 
+  Napi::Value Cancel(const Napi::CallbackInfo& info);
+
   Napi::Value PoolSubmit(const Napi::CallbackInfo& info);
 
   Napi::Value PoolEmplace(const Napi::CallbackInfo& info);
@@ -172,6 +355,24 @@ private:
 
   Napi::Value Native(const Napi::CallbackInfo& info);
 
+  Napi::Value GetStartupTimeline(const Napi::CallbackInfo& info);
+
+  Napi::Value StartTracing(const Napi::CallbackInfo& info);
+
+  Napi::Value StopTracing(const Napi::CallbackInfo& info);
+
+  Napi::Value Metrics(const Napi::CallbackInfo& info);
+
+  Napi::Value Step(const Napi::CallbackInfo& info);
+
+  Napi::Value StartStallWatchdog(const Napi::CallbackInfo& info);
+
+  Napi::Value StopStallWatchdog(const Napi::CallbackInfo& info);
+
+  Napi::Value RequestIdle(const Napi::CallbackInfo& info);
+
+  Napi::Value CancelIdle(const Napi::CallbackInfo& info);
+
 
 
   // Static helpers
@@ -190,28 +391,38 @@ private:
 
   static void OnPrepare(uv_prepare_t* handle);
 
+  static void RunOnce(Application* app);
+
   void StartEventLoop();
 
   void StopEventLoop();
 
+  void WaitNativeLoop();
 
+  void LeaveNativeLoop();
 
-  // Callback plumbing
-
-  struct PostTask {
+  void CheckIdle();
 
-    Napi::ThreadSafeFunction tsfn;
+  void RunIdleTasks(Napi::Env env);
 
-  };
 
 
+  // Callback plumbing
 
-  struct DispatchTask {
+  // post() (no deferred) or dispatch() task waiting in a priority lane; callbacks are
+  // referenced on the JS thread and invoked by DrainLanes, not per-task TSFNs
+  struct LaneTask {
 
-    Napi::ThreadSafeFunction tsfn;
+    Napi::FunctionReference callback;
 
     std::shared_ptr<Napi::Promise::Deferred> deferred;
 
+    uint64_t queued = 0;
+
+    size_t lane = 1;
+
+    std::string key;  // post({ key }): at most one pending task per key
+
   };
 
 
@@ -222,13 +433,29 @@ private:
 
     std::shared_ptr<Napi::Promise::Deferred> deferred;
 
+    uint64_t queued = 0;
+
   };
 
 
 
-  static void ProcessPostTask();
+  void Enqueue(Napi::Env env, size_t lane, std::shared_ptr<LaneTask> task);
+
+  static void ScheduleDrain();
+
+  static void ProcessLanes();
+
+  static void DrainLanes(Napi::Env env);
+
+  static bool RunLaneTask(Napi::Env env, std::shared_ptr<LaneTask> task);
+
+  static bool LanesEmpty();
 
-  static void ProcessDispatchTask();
+  static void ReleaseLanes();
+
+  static void OnLanesEnvCleanup(void* arg);
+
+  static bool LoopIdle();
 
   static void ProcessPoolTask();
 
@@ -236,15 +463,24 @@ private:
 
   // Global task queues (one application is expected)
 
-  static std::mutex post_mutex_;
+  // Lanes by priority: 0 user-blocking, 1 normal, 2 background
+  static std::mutex lanes_mutex_;
+
+  static std::array<std::deque<std::shared_ptr<LaneTask>>, 3> lanes_;
+
+  static std::atomic<bool> drain_posted_;
 
-  static std::queue<std::shared_ptr<PostTask>> post_queue_;
+  static std::atomic<bool> drain_ready_;
 
+  static bool manual_lanes_;
 
+  static std::atomic<saucer_application*> lanes_app_;
 
-  static std::mutex dispatch_mutex_;
+  static Napi::ThreadSafeFunction lane_tsfn_;
 
-  static std::queue<std::shared_ptr<DispatchTask>> dispatch_queue_;
+  static napi_env lanes_env_;  // env that owns lane_tsfn_ and the queued callbacks
+
+  static std::unordered_map<std::string, std::shared_ptr<LaneTask>> keyed_tasks_;
 
 
 
@@ -285,6 +521,11 @@ public:
   // Public accessor for PDF module
   saucer_handle* GetWebview() { return webview_; }
 
+  // PDF exports render from this view on a worker; close() waits for them (see Close)
+  void BeginExport() { ++pending_exports_; }
+
+  void EndExport();
+
 private:
 
   saucer_handle* webview_ = nullptr;
@@ -293,6 +534,10 @@ private:
 
   Napi::ObjectReference parent_ref_;
 
+  uint32_t pending_exports_ = 0;
+
+  bool close_after_exports_ = false;
+
 
 
   // Thread-safe function for callbacks
@@ -311,6 +556,11 @@ private:
 
   std::unordered_map<std::string, std::vector<std::shared_ptr<CallbackData>>> event_callbacks_;
 
+  // Native subscription id per event type, held while any JS listener exists
+  std::unordered_map<std::string, uint64_t> event_subscriptions_;
+
+  uint64_t next_listener_id_ = 0;
+
   std::mutex callback_mutex_;
 
 
@@ -333,8 +583,86 @@ private:
 
     std::shared_ptr<Napi::ThreadSafeFunction> tsfn;
 
+    metrics::RpcMetrics* metrics = nullptr;
+
+    bool raw = false;
+
+  };
+
+
+
+  // Calls the page coalesced into one __saucer_batch message (rpcBatching); resolved together
+  struct RpcBatch {
+
+    std::mutex mutex;
+
+    std::optional<saucer::executor<glz::json_t>> executor;
+
+    std::vector<glz::json_t> results;
+
+    size_t remaining = 0;
+
+  };
+
+
+
+  // One in-flight call of a (non-raw) exposed function, owned by the process-wide pool
+  struct RpcCall {
+
+    uint32_t slot = 0;
+
+    uint32_t generation = 0;
+
+    std::shared_ptr<ExposedCallback> entry;
+
+    std::optional<saucer::executor<glz::json_t>> executor;
+
+    std::shared_ptr<RpcBatch> batch;  // set instead of `executor` for calls that arrived batched
+
+    uint32_t index = 0;
+
+    std::string params;
+
+    uint64_t queued = 0;
+
+    uint64_t received = 0;
+
   };
 
+  static std::mutex rpc_pool_mutex_;
+
+  static std::vector<std::unique_ptr<RpcCall>> rpc_calls_;
+
+  static std::vector<uint32_t> rpc_free_;
+
+  static RpcCall* AcquireRpcCall();
+
+  static RpcCall* FindRpcCall(double id);
+
+  static double RpcCallId(const RpcCall* call);
+
+  static void ResolveRpcCall(RpcCall* call, glz::json_t value);
+
+  static void RejectRpcCall(RpcCall* call, std::string reason);
+
+  static void RecycleRpcCall(RpcCall* call, bool ok);
+
+  static void SettleRpcCall(const Napi::CallbackInfo& info, bool ok);
+
+  static void OnRpcFulfilled(const Napi::CallbackInfo& info);
+
+  static void OnRpcRejected(const Napi::CallbackInfo& info);
+
+  static void SetRpcSettle(const Napi::CallbackInfo& info);
+
+  static void CallExposed(napi_env env, napi_value js_callback, void* context, void* data);
+
+  static void CompleteBatchItem(RpcCall* call, glz::json_t result);
+
+  void ExposeBatch();
+
+  bool rpc_batching_ = false;
+
 
 
   std::vector<std::shared_ptr<ExposedCallback>> exposed_callbacks_;
@@ -408,6 +736,12 @@ private:
   Napi::Value GetZoom(const Napi::CallbackInfo& info);
   void SetZoom(const Napi::CallbackInfo& info, const Napi::Value& value);
 
+  // Batched geometry snapshot (position, size, fullscreen, maximized, zoom)
+  Napi::Value GetGeometry(const Napi::CallbackInfo& info);
+
+  // Batched, validated property setter
+  void Apply(const Napi::CallbackInfo& info);
+
   Napi::Value GetParent(const Napi::CallbackInfo& info);
 
   void Show(const Napi::CallbackInfo& info);
@@ -492,6 +826,7 @@ private:
   struct SchemeHandler {
     std::string name;
     std::shared_ptr<Napi::ThreadSafeFunction> tsfn;
+    metrics::SchemeMetrics* metrics = nullptr;
   };
 
   std::vector<std::shared_ptr<SchemeHandler>> scheme_handlers_;
@@ -524,7 +859,11 @@ private:
 
   static Napi::Value ParseJson(Napi::Env env, const std::string& json);
 
-  static std::vector<glz::json_t> CollectJsonArgs(const Napi::CallbackInfo& info, size_t startIndex);
+  static std::string RawJsonForRPC(Napi::Env env, Napi::Value value);
+
+  void ExposeRaw(saucer_handle* handle, std::string name, std::shared_ptr<ExposedCallback> entry, bool as_buffer);
+
+  static std::vector<glz::raw_json> CollectJsonArgs(const Napi::CallbackInfo& info, size_t startIndex);
 
   static Webview* FromHandle(saucer_handle* handle);
 
@@ -538,7 +877,11 @@ private:
 
   bool EvaluatePolicy(const std::string& event, std::function<Napi::Value(Napi::Env, Napi::Function)> invoker);
 
-  void RemoveOnceCallbacks(const std::string& event);
+  std::vector<std::shared_ptr<CallbackData>> TakeCallbacks(const std::string& event, bool* drained);
+
+  void ReleaseOnceListener(const std::string& event, const std::shared_ptr<CallbackData>& cb, bool last);
+
+  void ReleaseSubscription(const std::string& event);
 
   void RemoveCallbackById(const std::string& event, uint64_t id);
 
@@ -548,6 +891,10 @@ private:
 
   bool HasCallbacks(const std::string& event);
 
+  static void* WindowEventForwarder(SAUCER_WINDOW_EVENT event);
+
+  static void* WebEventForwarder(SAUCER_WEB_EVENT event);
+
 
 
   // Window event forwarders
@@ -582,6 +929,15 @@ private:
 
   static void OnWebLoad(saucer_handle* handle, SAUCER_STATE state);
 
+
+  // Startup timeline listeners (registered natively, independent of JS callbacks)
+
+  static void OnStartupLoad(saucer_handle* handle, SAUCER_STATE state);
+
+  static void OnStartupDomReady(saucer_handle* handle);
+
+  uint64_t startup_load_listener_ = 0;  // removed once the timeline completes
+
 };
 
 
@@ -594,15 +950,23 @@ private:
 
 
 
-std::mutex Application::post_mutex_;
+std::mutex Application::lanes_mutex_;
+
+std::array<std::deque<std::shared_ptr<Application::LaneTask>>, 3> Application::lanes_;
+
+std::atomic<bool> Application::drain_posted_{false};
 
-std::queue<std::shared_ptr<Application::PostTask>> Application::post_queue_;
+std::atomic<bool> Application::drain_ready_{false};
 
+bool Application::manual_lanes_ = false;
 
+std::atomic<saucer_application*> Application::lanes_app_{nullptr};
 
-std::mutex Application::dispatch_mutex_;
+Napi::ThreadSafeFunction Application::lane_tsfn_;
 
-std::queue<std::shared_ptr<Application::DispatchTask>> Application::dispatch_queue_;
+napi_env Application::lanes_env_ = nullptr;
+
+std::unordered_map<std::string, std::shared_ptr<Application::LaneTask>> Application::keyed_tasks_;
 
 
 
@@ -638,6 +1002,8 @@ Napi::Object Application::Init(Napi::Env env, Napi::Object exports) {
 
     InstanceMethod("dispatch", &Application::Dispatch),
 
+    InstanceMethod("cancel", &Application::Cancel),
+
     InstanceMethod("poolSubmit", &Application::PoolSubmit),
 
     InstanceMethod("poolEmplace", &Application::PoolEmplace),
@@ -648,15 +1014,29 @@ Napi::Object Application::Init(Napi::Env env, Napi::Object exports) {
 
     InstanceMethod("nativeHandle", &Application::Native),
 
-  });
+    InstanceMethod("getStartupTimeline", &Application::GetStartupTimeline),
+
+    InstanceMethod("startTracing", &Application::StartTracing),
 
+    InstanceMethod("stopTracing", &Application::StopTracing),
 
+    InstanceMethod("metrics", &Application::Metrics),
 
-  Napi::FunctionReference* constructor = new Napi::FunctionReference();
+    InstanceMethod("step", &Application::Step),
 
-  *constructor = Napi::Persistent(func);
+    InstanceMethod("startStallWatchdog", &Application::StartStallWatchdog),
 
-  env.SetInstanceData(constructor);
+    InstanceMethod("stopStallWatchdog", &Application::StopStallWatchdog),
+
+    InstanceMethod("requestIdle", &Application::RequestIdle),
+
+    InstanceMethod("cancelIdle", &Application::CancelIdle),
+
+  });
+
+
+
+  GetAddonData(env).application = Napi::Persistent(func);
 
 
 
@@ -674,6 +1054,8 @@ Application::Application(const Napi::CallbackInfo& info)
 
   Napi::Env env = info.Env();
 
+  StartupTimeline::Mark("application.constructor");
+
 
 
   // Support wrapping an existing native handle (from Application.active)
@@ -754,13 +1136,30 @@ Application::Application(const Napi::CallbackInfo& info)
 
       }
 
+      if (opts.Has("loop") && !opts.Get("loop").IsUndefined()) {
+        std::string loop = opts.Get("loop").IsString() ? opts.Get("loop").As<Napi::String>().Utf8Value() : "";
+
+        if (loop == "native") {
+          loop_mode_ = LoopMode::Native;
+        } else if (loop == "manual") {
+          loop_mode_ = LoopMode::Manual;
+        } else if (loop != "libuv") {
+          saucer_options_free(options);
+          Napi::TypeError::New(env, "loop must be \"libuv\", \"native\" or \"manual\"").ThrowAsJavaScriptException();
+          return;
+        }
+      }
+
     }
 
 
 
     // Initialize application (this creates NSApplication on macOS)
 
-    app_ = saucer_application_init(options);
+    {
+      StartupTimeline::Span span("saucer_application_init");
+      app_ = saucer_application_init(options);
+    }
 
     owns_app_handle_ = true;
 
@@ -790,9 +1189,19 @@ Application::Application(const Napi::CallbackInfo& info)
 
 
 
-  // Start event loop integration
+  lanes_app_ = app_;
+
+  manual_lanes_ = loop_mode_ == LoopMode::Manual;
+
 
-  StartEventLoop();
+
+  // Start event loop integration (manual mode leaves saucer idle until step())
+
+  if (loop_mode_ != LoopMode::Manual) {
+    StartEventLoop();
+  }
+
+  StartupTimeline::Mark("application.event-loop");
 
 
 
@@ -814,8 +1223,24 @@ Application::Application(const Napi::CallbackInfo& info)
 
 Application::~Application() {
 
+  if (stall_watchdog_) {
+    watchdog::Stop();
+    stall_tsfn_.Release();
+  }
+
   StopEventLoop();
 
+  if (idle_tsfn_) {
+    idle_tsfn_.Release();
+  }
+
+
+
+  if (lanes_app_ == app_) {
+    lanes_app_ = nullptr;
+    ReleaseLanes();
+  }
+
 
 
   if (app_ && owns_app_handle_) {
@@ -862,7 +1287,7 @@ Napi::Value Application::InitApp(const Napi::CallbackInfo& info) {
 
 
 
-  auto* constructor = env.GetInstanceData<Napi::FunctionReference>();
+  Napi::FunctionReference& constructor = GetAddonData(env).application;
 
   std::vector<napi_value> args;
 
@@ -874,7 +1299,7 @@ Napi::Value Application::InitApp(const Napi::CallbackInfo& info) {
 
 
 
-  Napi::Object instance = constructor->New(args);
+  Napi::Object instance = constructor.New(args);
 
 
 
@@ -926,9 +1351,9 @@ Napi::Value Application::Active(const Napi::CallbackInfo& info) {
 
 
 
-  auto* constructor = env.GetInstanceData<Napi::FunctionReference>();
+  Napi::FunctionReference& constructor = GetAddonData(env).application;
 
-  Napi::Object instance = constructor->New({ Napi::External<saucer_application>::New(env, handle) });
+  Napi::Object instance = constructor.New({ Napi::External<saucer_application>::New(env, handle) });
 
 
 
@@ -1012,6 +1437,12 @@ void Application::StopEventLoop() {
 
   running_ = false;
 
+  if (native_loop_active_) {
+    ::saucer_loop_detach_uv_ext();
+    native_loop_active_ = false;
+    run_tsfn_.Release();
+  }
+
 
 
   if (check_handle_) {
@@ -1066,6 +1497,40 @@ void Application::StopEventLoop() {
 
   }
 
+
+
+  if (idle_handle_) {
+
+    uv_close(reinterpret_cast<uv_handle_t*>(idle_handle_),
+
+      [](uv_handle_t* handle) {
+
+        delete reinterpret_cast<uv_idle_t*>(handle);
+
+      });
+
+    idle_handle_ = nullptr;
+
+  }
+
+}
+
+
+
+// One saucer loop iteration, shared by the timer/check/prepare hooks
+void Application::RunOnce(Application* app) {
+  SAUCER_NODEJS_TRACE_SCOPE("loop", "run_once");
+
+  uint64_t started = tracing::Now();
+  watchdog::Beat(started);
+  saucer_application_run_once(app->app_);
+
+  metrics::loop_iterations.Add();
+  metrics::loop_time.Record(tracing::Now() - started);
+
+  if (!app->idle_tasks_.empty()) {
+    app->CheckIdle();
+  }
 }
 
 
@@ -1078,13 +1543,22 @@ void Application::OnTimer(uv_timer_t* handle) {
 
   Application* app = static_cast<Application*>(handle->data);
 
-  if (app && app->running_ && app->app_) {
+  // Native loop mode only restarts the timer to watch for idle periods while requestIdle() work waits
+  if (app && app->native_loop_active_) {
+    app->CheckIdle();
+    if (app->idle_tasks_.empty()) {
+      uv_timer_stop(handle);
+    }
+    return;
+  }
+
+  if (app && app->running_ && app->app_ && !app->native_loop_active_) {
 
     // Run one iteration of saucer's event loop
 
     // This is non-blocking and processes pending events
 
-    saucer_application_run_once(app->app_);
+    RunOnce(app);
 
   }
 
@@ -1100,13 +1574,19 @@ void Application::OnCheck(uv_check_t* handle) {
 
   Application* app = static_cast<Application*>(handle->data);
 
-  if (app && app->running_ && app->app_) {
+  // Native mode: the check phase is where GLib takes the thread, outside any JS frame
+  if (app && app->native_loop_active_) {
+    app->WaitNativeLoop();
+    return;
+  }
+
+  if (app && app->running_ && app->app_ && !app->native_loop_active_) {
 
     // Run on every check to ensure maximum responsiveness
 
     // This allows the webview to update as fast as possible
 
-    saucer_application_run_once(app->app_);
+    RunOnce(app);
 
   }
 
@@ -1120,26 +1600,96 @@ void Application::OnPrepare(uv_prepare_t* handle) {
 
   Application* app = static_cast<Application*>(handle->data);
 
-  if (app && app->running_ && app->app_) {
+  if (app && app->running_ && app->app_ && !app->native_loop_active_) {
 
     // Run before polling to ensure we don't wait for I/O if there are UI events
 
-    saucer_application_run_once(app->app_);
+    RunOnce(app);
+
+  }
+
+}
+
+
+
+Napi::Value Application::Run(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  auto deferred = Napi::Promise::Deferred::New(env);
+
+  // Default mode: the libuv hooks already pump saucer, so there is nothing to hand over
+  if (loop_mode_ != LoopMode::Native || !app_) {
+    deferred.Resolve(env.Undefined());
+    return deferred.Promise();
+  }
+
+  if (native_loop_active_) {
+    deferred.Reject(Napi::Error::New(env, "Application is already running its native loop").Value());
+    return deferred.Promise();
+  }
+
+  // Platforms that cannot host libuv keep the default integration and resolve immediately
+  if (!::saucer_loop_attach_uv_ext(uv_default_loop())) {
+    deferred.Resolve(env.Undefined());
+    return deferred.Promise();
+  }
+
+  // Nothing blocks here: the next check phase hands the thread to GLib, so Node callbacks keep
+  // running from uv_run as top-level callbacks and drain microtasks
+  run_deferred_ = std::make_shared<Napi::Promise::Deferred>(deferred);
+  run_tsfn_ = Napi::ThreadSafeFunction::New(env, Napi::Function::New(env, [](const Napi::CallbackInfo&) {}), "saucer.app.run", 0, 1);
+  native_loop_active_ = true;
+  native_quit_ = false;
+
+  // No polling timer while the native loop owns the thread
+  if (timer_handle_) {
+    uv_timer_stop(timer_handle_);
+  }
 
+  // Referenced, so the process stays up until quit() like a blocking run() would
+  if (!idle_handle_) {
+    idle_handle_ = new uv_idle_t();
+    uv_idle_init(uv_default_loop(), idle_handle_);
   }
+  uv_idle_start(idle_handle_, [](uv_idle_t*) {});
 
+  return deferred.Promise();
 }
 
+// Native mode, once per uv_run iteration: GLib does the blocking wait until libuv's fd is readable
+// or its next timer is due, then this returns and uv_run runs those callbacks itself. libuv is
+// never re-entered from GLib
+void Application::WaitNativeLoop() {
+  // An active idle handle zeroes libuv's timeout, which would turn the wait into a spin
+  uv_idle_stop(idle_handle_);
 
+  // The hooks stop beating while GLib owns the thread
+  watchdog::Suspend(true);
+  ::saucer_loop_wait_uv_ext(&native_quit_);
+  watchdog::Suspend(false);
 
-void Application::Run(const Napi::CallbackInfo& info) {
+  if (native_quit_ || !running_) {
+    LeaveNativeLoop();
+    return;
+  }
 
-  // In our integrated approach, we don't need to call run()
+  // Keep the coming poll phase from blocking so GLib gets the thread back after the callbacks
+  uv_idle_start(idle_handle_, [](uv_idle_t*) {});
+}
 
-  // The event loop is already running via uv_timer_t
+void Application::LeaveNativeLoop() {
+  ::saucer_loop_detach_uv_ext();
+  native_loop_active_ = false;
 
-  // This method exists for compatibility but does nothing
+  if (running_ && timer_handle_) {
+    uv_timer_start(timer_handle_, OnTimer, 0, 1);
+  }
 
+  auto deferred = std::move(run_deferred_);
+  napi_status status = run_tsfn_.NonBlockingCall([deferred](Napi::Env env, Napi::Function) {
+    deferred->Resolve(env.Undefined());
+  });
+  metrics::TrackCall(status == napi_ok);
+  run_tsfn_.Release();
 }
 
 
@@ -1162,15 +1712,44 @@ Napi::Value Application::Quit(const Napi::CallbackInfo& info) {
 
   }
 
+  // Ends the native loop at its next wait (run() resolves then)
+  native_quit_ = true;
+
   return info.Env().Undefined();
 
 }
 
 
 
-void Application::Post(const Napi::CallbackInfo& info) {
+// post()/dispatch() options: { priority: "user-blocking" | "normal" | "background" }
+static bool ParseLane(Napi::Env env, const Napi::CallbackInfo& info, size_t index, size_t& lane) {
+  lane = 1;
 
-  Napi::Env env = info.Env();
+  if (info.Length() <= index || !info[index].IsObject()) {
+    return true;
+  }
+
+  Napi::Value priority = info[index].As<Napi::Object>().Get("priority");
+  if (priority.IsUndefined()) {
+    return true;
+  }
+
+  std::string name = priority.IsString() ? priority.As<Napi::String>().Utf8Value() : "";
+  if (name == "user-blocking") {
+    lane = 0;
+  } else if (name == "background") {
+    lane = 2;
+  } else if (name != "normal") {
+    Napi::TypeError::New(env, "priority must be \"user-blocking\", \"normal\" or \"background\"").ThrowAsJavaScriptException();
+    return false;
+  }
+
+  return true;
+}
+
+void Application::Post(const Napi::CallbackInfo& info) {
+
+  Napi::Env env = info.Env();
 
 
 
@@ -1194,109 +1773,136 @@ void Application::Post(const Napi::CallbackInfo& info) {
 
 
 
-  auto tsfn = Napi::ThreadSafeFunction::New(
+  size_t lane = 1;
 
-    env,
+  if (!ParseLane(env, info, 1, lane)) {
 
-    info[0].As<Napi::Function>(),
+    return;
 
-    "saucer.application.post",
+  }
 
-    0,
 
-    1
 
-  );
+  std::string key;
 
+  if (info.Length() > 1 && info[1].IsObject()) {
 
+    Napi::Value value = info[1].As<Napi::Object>().Get("key");
 
-  auto task = std::make_shared<PostTask>();
+    if (!value.IsUndefined()) {
 
-  task->tsfn = tsfn;
+      if (!value.IsString()) {
 
+        Napi::TypeError::New(env, "key must be a string").ThrowAsJavaScriptException();
 
+        return;
 
-  {
+      }
 
-    std::scoped_lock lock(post_mutex_);
+      key = value.As<Napi::String>().Utf8Value();
 
-    post_queue_.push(task);
+    }
 
   }
 
 
 
-  saucer_application_post(app_, &Application::ProcessPostTask);
+  auto task = std::make_shared<LaneTask>();
 
-}
+  task->callback = Napi::Persistent(info[0].As<Napi::Function>());
 
+  task->queued = tracing::Timestamp();
 
+  task->key = std::move(key);
 
-Napi::Value Application::Dispatch(const Napi::CallbackInfo& info) {
 
-  Napi::Env env = info.Env();
 
+  Enqueue(env, lane, task);
 
+}
 
-  if (info.Length() == 0 || !info[0].IsFunction()) {
 
-    Napi::TypeError::New(env, "Callback must be a function").ThrowAsJavaScriptException();
 
+// Drop the pending post() queued under `key`; the callback never reaches JS
+Napi::Value Application::Cancel(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() < 1 || !info[0].IsString()) {
+    Napi::TypeError::New(env, "key must be a string").ThrowAsJavaScriptException();
     return env.Undefined();
+  }
+
+  std::shared_ptr<LaneTask> task;
+  {
+    std::scoped_lock lock(lanes_mutex_);
+    auto it = keyed_tasks_.find(info[0].As<Napi::String>().Utf8Value());
+    if (it == keyed_tasks_.end()) {
+      return Napi::Boolean::New(env, false);
+    }
+
+    task = std::move(it->second);
+    keyed_tasks_.erase(it);
 
+    auto& lane = lanes_[task->lane];
+    lane.erase(std::find(lane.begin(), lane.end(), task));
   }
 
+  metrics::loop_coalesced.Add();
+  task->callback.Reset();
+  return Napi::Boolean::New(env, true);
+}
 
 
-  if (!app_) {
 
-    Napi::Error::New(env, "Application handle is not available").ThrowAsJavaScriptException();
+Napi::Value Application::Dispatch(const Napi::CallbackInfo& info) {
 
-    return env.Undefined();
+  Napi::Env env = info.Env();
 
-  }
 
 
+  if (info.Length() == 0 || !info[0].IsFunction()) {
 
-  auto deferred = std::make_shared<Napi::Promise::Deferred>(Napi::Promise::Deferred::New(env));
+    Napi::TypeError::New(env, "Callback must be a function").ThrowAsJavaScriptException();
 
-  auto tsfn = Napi::ThreadSafeFunction::New(
+    return env.Undefined();
 
-    env,
+  }
 
-    info[0].As<Napi::Function>(),
 
-    "saucer.application.dispatch",
 
-    0,
+  if (!app_) {
 
-    1
+    Napi::Error::New(env, "Application handle is not available").ThrowAsJavaScriptException();
 
-  );
+    return env.Undefined();
 
+  }
 
 
-  auto task = std::make_shared<DispatchTask>();
 
-  task->tsfn = tsfn;
+  size_t lane = 1;
 
-  task->deferred = deferred;
+  if (!ParseLane(env, info, 1, lane)) {
 
+    return env.Undefined();
 
+  }
 
-  {
 
-    std::scoped_lock lock(dispatch_mutex_);
 
-    dispatch_queue_.push(task);
+  auto task = std::make_shared<LaneTask>();
 
-  }
+  task->callback = Napi::Persistent(info[0].As<Napi::Function>());
 
+  task->deferred = std::make_shared<Napi::Promise::Deferred>(Napi::Promise::Deferred::New(env));
 
+  task->queued = tracing::Timestamp();
 
-  saucer_application_post(app_, &Application::ProcessDispatchTask);
 
-  return deferred->Promise();
+
+  Enqueue(env, lane, task);
+
+  return task->deferred->Promise();
 
 }
 
@@ -1350,6 +1956,8 @@ Napi::Value Application::PoolSubmit(const Napi::CallbackInfo& info) {
 
   task->tsfn = tsfn;
 
+  task->queued = tracing::Timestamp();
+
   task->deferred = deferred;
 
 
@@ -1420,6 +2028,8 @@ Napi::Value Application::PoolEmplace(const Napi::CallbackInfo& info) {
 
   task->tsfn = tsfn;
 
+  task->queued = tracing::Timestamp();
+
 
 
   {
@@ -1466,122 +2076,662 @@ Napi::Value Application::Native(const Napi::CallbackInfo& info) {
 
 }
 
+Napi::Value Application::GetStartupTimeline(const Napi::CallbackInfo& info) {
+  return StartupTimeline::ToJS(info.Env());
+}
 
+Napi::Value Application::StartTracing(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  size_t events_per_thread = 16384;
 
-void Application::ProcessPostTask() {
+  if (info.Length() > 0 && info[0].IsObject()) {
+    Napi::Object opts = info[0].As<Napi::Object>();
+    if (opts.Has("eventsPerThread") && opts.Get("eventsPerThread").IsNumber()) {
+      int64_t requested = opts.Get("eventsPerThread").As<Napi::Number>().Int64Value();
+      if (requested <= 0) {
+        Napi::RangeError::New(env, "eventsPerThread must be a positive number").ThrowAsJavaScriptException();
+        return env.Undefined();
+      }
+      events_per_thread = static_cast<size_t>(requested);
+    }
+  }
 
-  std::shared_ptr<PostTask> task;
+  return Napi::Boolean::New(env, tracing::Start(events_per_thread));
+}
 
-  {
+Napi::Value Application::StopTracing(const Napi::CallbackInfo& info) {
+  return Napi::String::New(info.Env(), tracing::Stop());
+}
 
-    std::scoped_lock lock(post_mutex_);
+// ============================================================================
+// Stall watchdog glue - finished stalls go to the owning Application, stall starts go
+// to stack samplers registered from worker threads (the Node thread is blocked then)
+// ============================================================================
 
-    if (post_queue_.empty()) return;
+static std::mutex stall_sampler_mutex;
+static std::unordered_map<uint64_t, Napi::ThreadSafeFunction> stall_samplers;
+static uint64_t next_stall_sampler = 0;
 
-    task = post_queue_.front();
+static void NotifyStallSamplers(const watchdog::Stall& stall) {
+  std::scoped_lock lock(stall_sampler_mutex);
+  for (auto& [key, tsfn] : stall_samplers) {
+    napi_status status = tsfn.NonBlockingCall([id = stall.id](Napi::Env env, Napi::Function jsCallback) {
+      jsCallback.Call({ Napi::Number::New(env, static_cast<double>(id)) });
+    });
+    metrics::TrackCall(status == napi_ok);
+  }
+}
 
-    post_queue_.pop();
+// watchdog.sample(callback) - called from lib/stall-sampler.js in a worker
+static Napi::Value RegisterStallSampler(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
+  if (info.Length() == 0 || !info[0].IsFunction()) {
+    Napi::TypeError::New(env, "Callback must be a function").ThrowAsJavaScriptException();
+    return env.Undefined();
   }
 
+  std::scoped_lock lock(stall_sampler_mutex);
+  uint64_t key = ++next_stall_sampler;
 
+  // Dropped from the registry when the worker's environment tears the TSFN down
+  auto tsfn = Napi::ThreadSafeFunction::New(env, info[0].As<Napi::Function>(), "saucer.watchdog.sample", 0, 1,
+    [key](Napi::Env) {
+      std::scoped_lock lock(stall_sampler_mutex);
+      stall_samplers.erase(key);
+    });
+  tsfn.Unref(env);
 
-  task->tsfn.NonBlockingCall([](Napi::Env env, Napi::Function jsCallback) {
+  stall_samplers.emplace(key, tsfn);
+  return env.Undefined();
+}
 
-    Napi::HandleScope scope(env);
+// watchdog.active(id) - lets a sampler discard a stack captured after the loop recovered
+static Napi::Value IsStallActive(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  uint64_t id = info.Length() > 0 && info[0].IsNumber() ? static_cast<uint64_t>(info[0].As<Napi::Number>().Int64Value()) : 0;
+  return Napi::Boolean::New(env, watchdog::Active(id));
+}
 
-    try {
+Napi::Value Application::StartStallWatchdog(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-      jsCallback.Call({});
+  if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsFunction()) {
+    Napi::TypeError::New(env, "Usage: startStallWatchdog(options, callback)").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
 
-    } catch (const Napi::Error& err) {
+  if (loop_mode_ == LoopMode::Manual) {
+    Napi::Error::New(env, "The stall watchdog needs the loop hooks; it is unavailable with loop: \"manual\"").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
 
-      err.ThrowAsJavaScriptException();
+  double threshold_ms = 100;
+  Napi::Object opts = info[0].As<Napi::Object>();
+  if (opts.Has("thresholdMs") && !opts.Get("thresholdMs").IsUndefined()) {
+    if (!opts.Get("thresholdMs").IsNumber() || opts.Get("thresholdMs").As<Napi::Number>().DoubleValue() < 1) {
+      Napi::RangeError::New(env, "thresholdMs must be a number >= 1").ThrowAsJavaScriptException();
+      return env.Undefined();
+    }
+    threshold_ms = opts.Get("thresholdMs").As<Napi::Number>().DoubleValue();
+  }
 
-    } catch (...) {
+  if (stall_watchdog_) {
+    watchdog::Stop();
+    stall_tsfn_.Release();
+  }
 
-      Napi::Error::New(env, "post callback failed").ThrowAsJavaScriptException();
+  stall_tsfn_ = Napi::ThreadSafeFunction::New(env, info[1].As<Napi::Function>(), "saucer.watchdog.stall", 0, 1);
+  stall_tsfn_.Unref(env);
+  stall_watchdog_ = true;
 
-    }
+  auto on_end = [tsfn = stall_tsfn_](const watchdog::Stall& stall) mutable {
+    // Report the start as wall-clock epoch ms alongside the duration
+    uint64_t ago = tracing::Now() - stall.started;
+    double started_at = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count() - static_cast<double>(ago) / 1e6;
 
-  });
+    napi_status status = tsfn.NonBlockingCall([stall, started_at](Napi::Env env, Napi::Function jsCallback) {
+      Napi::Object info = Napi::Object::New(env);
+      info.Set("id", static_cast<double>(stall.id));
+      info.Set("duration", static_cast<double>(stall.duration) / 1e6);
+      info.Set("startedAt", started_at);
+      jsCallback.Call({ info });
+    });
+    metrics::TrackCall(status == napi_ok);
+  };
 
+  watchdog::Start(static_cast<uint64_t>(threshold_ms * 1e6), NotifyStallSamplers, on_end);
+  return env.Undefined();
+}
 
+Napi::Value Application::StopStallWatchdog(const Napi::CallbackInfo& info) {
+  if (stall_watchdog_) {
+    watchdog::Stop();
+    stall_tsfn_.Release();
+    stall_watchdog_ = false;
+  }
+  return info.Env().Undefined();
+}
 
-  task->tsfn.Release();
+static Napi::Object HistogramToJS(Napi::Env env, const metrics::Histogram& histogram) {
+  auto summary = histogram.Summarize();
 
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("count", static_cast<double>(summary.count));
+  result.Set("sum", summary.sum);
+  result.Set("min", summary.min);
+  result.Set("max", summary.max);
+  result.Set("mean", summary.count ? summary.sum / static_cast<double>(summary.count) : 0.0);
+  result.Set("p50", summary.p50);
+  result.Set("p90", summary.p90);
+  result.Set("p99", summary.p99);
+  return result;
 }
 
+Napi::Value Application::Metrics(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
+  auto counter = [](const metrics::Counter& c) { return static_cast<double>(c.Value()); };
 
-void Application::ProcessDispatchTask() {
+  Napi::Object loop = Napi::Object::New(env);
+  loop.Set("iterations", counter(metrics::loop_iterations));
+  loop.Set("iterationTime", HistogramToJS(env, metrics::loop_time));
+  loop.Set("tasks", counter(metrics::loop_tasks));
+  loop.Set("coalesced", counter(metrics::loop_coalesced));
 
-  std::shared_ptr<DispatchTask> task;
+  Napi::Object queues = Napi::Object::New(env);
+  {
+    std::scoped_lock lock(lanes_mutex_);
+    size_t posts = 0;
+    size_t dispatches = 0;
+    for (const auto& lane : lanes_) {
+      for (const auto& task : lane) {
+        (task->deferred ? dispatches : posts)++;
+      }
+    }
+    queues.Set("post", static_cast<double>(posts));
+    queues.Set("dispatch", static_cast<double>(dispatches));
 
+    Napi::Object lanes = Napi::Object::New(env);
+    lanes.Set("userBlocking", static_cast<double>(lanes_[0].size()));
+    lanes.Set("normal", static_cast<double>(lanes_[1].size()));
+    lanes.Set("background", static_cast<double>(lanes_[2].size()));
+    queues.Set("lanes", lanes);
+  }
   {
+    std::scoped_lock lock(pool_mutex_);
+    queues.Set("pool", static_cast<double>(pool_queue_.size()));
+  }
 
-    std::scoped_lock lock(dispatch_mutex_);
+  Napi::Object tsfn = Napi::Object::New(env);
+  tsfn.Set("calls", counter(metrics::tsfn_calls));
+  tsfn.Set("dropped", counter(metrics::tsfn_dropped));
 
-    if (dispatch_queue_.empty()) return;
+  Napi::Object rpc = Napi::Object::New(env);
+  for (const auto& [name, entry] : metrics::RpcTable()) {
+    Napi::Object item = Napi::Object::New(env);
+    item.Set("calls", counter(entry->calls));
+    item.Set("errors", counter(entry->errors));
+    item.Set("latency", HistogramToJS(env, entry->latency));
+    rpc.Set(name, item);
+  }
+
+  Napi::Object rpc_pool = Napi::Object::New(env);
+  rpc_pool.Set("records", counter(metrics::rpc_call_records));
 
-    task = dispatch_queue_.front();
+  Napi::Object schemes = Napi::Object::New(env);
+  for (const auto& [name, entry] : metrics::SchemeTable()) {
+    Napi::Object item = Napi::Object::New(env);
+    item.Set("requests", counter(entry->requests));
+    item.Set("bytes", counter(entry->bytes));
+    item.Set("latency", HistogramToJS(env, entry->latency));
+    schemes.Set(name, item);
+  }
 
-    dispatch_queue_.pop();
+  Napi::Object evaluate = Napi::Object::New(env);
+  evaluate.Set("latency", HistogramToJS(env, metrics::evaluate_latency));
 
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("loop", loop);
+  result.Set("queues", queues);
+  result.Set("tsfn", tsfn);
+  result.Set("rpc", rpc);
+  result.Set("rpcPool", rpc_pool);
+  result.Set("schemes", schemes);
+  result.Set("evaluate", evaluate);
+  return result;
+}
+
+// Advance saucer's loop explicitly (loop: "manual") and report what the iterations processed
+Napi::Value Application::Step(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (loop_mode_ != LoopMode::Manual) {
+    Napi::Error::New(env, "step() requires Application.init({ loop: \"manual\" })").ThrowAsJavaScriptException();
+    return env.Undefined();
   }
 
+  if (!app_) {
+    Napi::Error::New(env, "Application handle is not available").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
 
+  bool until_idle = false;
+  double max_iterations = 1;
+  double timeout_ms = -1;
 
-  // Keep task alive until JS callback runs
+  if (info.Length() > 0 && info[0].IsObject()) {
+    Napi::Object opts = info[0].As<Napi::Object>();
 
-  auto* holder = new std::shared_ptr<DispatchTask>(task);
+    if (opts.Has("untilIdle")) {
+      until_idle = opts.Get("untilIdle").ToBoolean().Value();
+      max_iterations = until_idle ? 10000 : 1;
+    }
 
+    if (opts.Has("maxIterations") && !opts.Get("maxIterations").IsUndefined()) {
+      if (!opts.Get("maxIterations").IsNumber() || opts.Get("maxIterations").As<Napi::Number>().DoubleValue() < 1) {
+        Napi::RangeError::New(env, "maxIterations must be a number >= 1").ThrowAsJavaScriptException();
+        return env.Undefined();
+      }
+      max_iterations = opts.Get("maxIterations").As<Napi::Number>().DoubleValue();
+    }
 
+    if (opts.Has("timeoutMs") && !opts.Get("timeoutMs").IsUndefined()) {
+      if (!opts.Get("timeoutMs").IsNumber() || opts.Get("timeoutMs").As<Napi::Number>().DoubleValue() < 0) {
+        Napi::RangeError::New(env, "timeoutMs must be a non-negative number").ThrowAsJavaScriptException();
+        return env.Undefined();
+      }
+      timeout_ms = opts.Get("timeoutMs").As<Napi::Number>().DoubleValue();
+    }
+  }
 
-  task->tsfn.NonBlockingCall(holder,
+  uint64_t tasks_before = metrics::loop_tasks.Value();
+  uint64_t calls_before = metrics::tsfn_calls.Value();
+  uint64_t started = tracing::Now();
+  uint64_t deadline = timeout_ms >= 0 ? started + static_cast<uint64_t>(timeout_ms * 1e6) : UINT64_MAX;
 
-    [](Napi::Env env, Napi::Function jsCallback, std::shared_ptr<DispatchTask>* holder) {
+  double iterations = 0;
+  bool idle = false;
 
-      auto& data = **holder;
+  while (iterations < max_iterations) {
+    RunOnce(this);
+    iterations++;
 
-      Napi::HandleScope scope(env);
+    // Run the post/dispatch tasks this iteration released, inside the step
+    if (drain_ready_) {
+      DrainLanes(env);
+      if (env.IsExceptionPending()) {
+        return env.Undefined();
+      }
+    }
 
-      try {
+    idle = !::saucer_loop_pending_ext();
+    if ((until_idle && idle) || tracing::Now() >= deadline) {
+      break;
+    }
+  }
 
-        Napi::Value result = jsCallback.Call({});
+  // requestIdle() callbacks get the idle period that follows the step (or their timeout)
+  if (!idle_tasks_.empty()) {
+    RunIdleTasks(env);
+    if (env.IsExceptionPending()) {
+      return env.Undefined();
+    }
+  }
 
-        if (data.deferred) {
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("iterations", iterations);
+  result.Set("tasks", static_cast<double>(metrics::loop_tasks.Value() - tasks_before));
+  result.Set("callbacks", static_cast<double>(metrics::tsfn_calls.Value() - calls_before));
+  result.Set("elapsed", static_cast<double>(tracing::Now() - started) / 1e6);
+  result.Set("idle", idle);
+  return result;
+}
 
-          data.deferred->Resolve(result);
 
-        }
 
-      } catch (const Napi::Error& err) {
+// ============================================================================
+// Idle tasks - requestIdle() callbacks run when an iteration leaves no pending UI
+// events and no post/dispatch work, or once their timeout passes
+// ============================================================================
 
-        if (data.deferred) {
+// requestIdleCallback's upper bound on one idle period
+constexpr uint64_t kIdlePeriod = 50'000'000;
 
-          data.deferred->Reject(err.Value());
+bool Application::LoopIdle() {
+  return !::saucer_loop_pending_ext() && LanesEmpty();
+}
 
-        }
+Napi::Value Application::RequestIdle(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-      } catch (...) {
+  if (info.Length() < 1 || !info[0].IsFunction()) {
+    Napi::TypeError::New(env, "Callback function required").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
 
-        if (data.deferred) {
+  uint64_t timeout = 0;
+  if (info.Length() > 1 && info[1].IsObject()) {
+    Napi::Value value = info[1].As<Napi::Object>().Get("timeout");
+    if (!value.IsUndefined()) {
+      if (!value.IsNumber() || value.As<Napi::Number>().DoubleValue() < 0) {
+        Napi::RangeError::New(env, "timeout must be a non-negative number").ThrowAsJavaScriptException();
+        return env.Undefined();
+      }
+      timeout = tracing::Now() + static_cast<uint64_t>(value.As<Napi::Number>().DoubleValue() * 1e6);
+    }
+  }
+
+  if (!idle_tsfn_) {
+    idle_tsfn_ = Napi::ThreadSafeFunction::New(env, Napi::Function::New(env, [](const Napi::CallbackInfo&) {}), "saucer.application.idle", 0, 1);
+    idle_tsfn_.Unref(env);
+  }
 
-          data.deferred->Reject(Napi::String::New(env, "dispatch callback failed"));
+  auto task = std::make_shared<IdleTask>();
+  task->id = ++next_idle_id_;
+  task->callback = Napi::Persistent(info[0].As<Napi::Function>());
+  task->timeout = timeout;
+  idle_tasks_.push_back(task);
+
+  // The native loop doesn't run the hooks, so poll for idle periods at frame rate meanwhile
+  if (native_loop_active_ && timer_handle_) {
+    uv_timer_start(timer_handle_, OnTimer, 16, 16);
+  }
+
+  return Napi::Number::New(env, static_cast<double>(task->id));
+}
+
+Napi::Value Application::CancelIdle(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
+  if (info.Length() < 1 || !info[0].IsNumber()) {
+    return Napi::Boolean::New(env, false);
+  }
+
+  uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Number>().DoubleValue());
+  auto it = std::find_if(idle_tasks_.begin(), idle_tasks_.end(), [id](const auto& task) { return task->id == id; });
+  if (it == idle_tasks_.end()) {
+    return Napi::Boolean::New(env, false);
+  }
+
+  (*it)->callback.Reset();
+  idle_tasks_.erase(it);
+  return Napi::Boolean::New(env, true);
+}
+
+// After an iteration: hand JS an idle pass when the loop has nothing to do or a timeout expired
+void Application::CheckIdle() {
+  if (idle_pass_pending_ || loop_mode_ == LoopMode::Manual || !idle_tsfn_) {
+    return;
+  }
+
+  uint64_t now = tracing::Now();
+  bool expired = std::any_of(idle_tasks_.begin(), idle_tasks_.end(), [now](const auto& task) {
+    return task->timeout != 0 && task->timeout <= now;
+  });
+
+  if (!expired && !LoopIdle()) {
+    return;
+  }
+
+  idle_pass_pending_ = true;
+  napi_status status = idle_tsfn_.NonBlockingCall([this](Napi::Env env, Napi::Function) {
+    idle_pass_pending_ = false;
+    RunIdleTasks(env);
+  });
+  metrics::TrackCall(status == napi_ok);
+
+  if (status != napi_ok) {
+    idle_pass_pending_ = false;
+  }
+}
+
+// Runs tasks in request order while the idle period lasts; expired tasks run regardless with
+// didTimeout set. Tasks requested from inside a callback wait for the next idle period.
+void Application::RunIdleTasks(Napi::Env env) {
+  Napi::HandleScope scope(env);
+
+  uint64_t now = tracing::Now();
+  uint64_t deadline = LoopIdle() ? now + kIdlePeriod : now;
+
+  // Shared by every callback in this pass; reports 0 as soon as UI work arrives
+  Napi::Function time_remaining = Napi::Function::New(env, [deadline](const Napi::CallbackInfo& info) {
+    uint64_t now = tracing::Now();
+    if (now >= deadline || ::saucer_loop_pending_ext()) {
+      return Napi::Number::New(info.Env(), 0);
+    }
+    return Napi::Number::New(info.Env(), static_cast<double>(deadline - now) / 1e6);
+  });
+
+  std::vector<std::shared_ptr<IdleTask>> pass(idle_tasks_.begin(), idle_tasks_.end());
+
+  for (auto& task : pass) {
+    if (task->callback.IsEmpty()) {
+      continue;  // cancelled by an earlier callback
+    }
+
+    now = tracing::Now();
+    bool timed_out = task->timeout != 0 && task->timeout <= now;
+    if (!timed_out && (now >= deadline || ::saucer_loop_pending_ext())) {
+      continue;
+    }
+
+    idle_tasks_.erase(std::find(idle_tasks_.begin(), idle_tasks_.end(), task));
+    metrics::loop_tasks.Add();
+
+    Napi::Object idle_deadline = Napi::Object::New(env);
+    idle_deadline.Set("didTimeout", timed_out);
+    idle_deadline.Set("timeRemaining", time_remaining);
+
+    Napi::FunctionReference callback = std::move(task->callback);
+    try {
+      callback.Value().Call({ idle_deadline });
+    } catch (const Napi::Error& err) {
+      err.ThrowAsJavaScriptException();
+      return;
+    } catch (...) {
+      Napi::Error::New(env, "requestIdle callback failed").ThrowAsJavaScriptException();
+      return;
+    }
+  }
+}
+
+
+
+// ============================================================================
+// Priority lanes - post()/dispatch() tasks wait in per-priority lanes; one saucer post
+// wakes the UI thread, which hands a drain pass to JS through a single shared TSFN
+// ============================================================================
+
+void Application::Enqueue(Napi::Env env, size_t lane, std::shared_ptr<LaneTask> task) {
+  if (!lane_tsfn_) {
+    lane_tsfn_ = Napi::ThreadSafeFunction::New(env, Napi::Function::New(env, [](const Napi::CallbackInfo&) {}), "saucer.application.lanes", 0, 1);
+    lane_tsfn_.Unref(env);
+
+    lanes_env_ = env;
+    napi_add_env_cleanup_hook(env, &Application::OnLanesEnvCleanup, nullptr);
+  }
+
+  task->lane = lane;
+
+  {
+    std::scoped_lock lock(lanes_mutex_);
+
+    // A newer keyed post() supersedes the pending one, which keeps its turn in the queue
+    if (!task->key.empty()) {
+      auto [it, inserted] = keyed_tasks_.try_emplace(task->key, task);
+      if (!inserted) {
+        std::shared_ptr<LaneTask>& pending = it->second;
+        metrics::loop_coalesced.Add();
+
+        if (pending->lane == lane) {
+          pending->callback = std::move(task->callback);
+          return;  // a drain is already scheduled for the pending task
         }
 
+        auto& previous = lanes_[pending->lane];
+        previous.erase(std::find(previous.begin(), previous.end(), pending));
+        pending = task;
       }
+    }
 
+    lanes_[lane].push_back(std::move(task));
+  }
 
+  ScheduleDrain();
+}
 
-      data.tsfn.Release();
+void Application::ScheduleDrain() {
+  if (drain_posted_.exchange(true)) {
+    return;
+  }
 
-      delete holder;
+  saucer_application* app = lanes_app_.load();
+  if (!app) {
+    drain_posted_ = false;
+    return;
+  }
 
-    });
+  saucer_application_post(app, &Application::ProcessLanes);
+}
+
+// UI thread: one wake-up per pass, however many tasks are queued
+void Application::ProcessLanes() {
+  drain_posted_ = false;
+
+  // Manual loop mode drains inside step() so callbacks run deterministically there
+  if (manual_lanes_) {
+    drain_ready_ = true;
+    return;
+  }
+
+  napi_status status = lane_tsfn_.NonBlockingCall([](Napi::Env env, Napi::Function) {
+    DrainLanes(env);
+  });
+  metrics::TrackCall(status == napi_ok);
+}
+
+// Weighted pass: every user-blocking task queued at the start, then normal tasks for up to
+// kNormalSlice and background tasks for up to kBackgroundSlice (at least one, so they never
+// starve). Leftovers go to the next pass, after the UI loop has had another iteration.
+void Application::DrainLanes(Napi::Env env) {
+  constexpr uint64_t kNormalSlice = 8'000'000;
+  constexpr uint64_t kBackgroundSlice = 2'000'000;
+
+  drain_ready_ = false;
+
+  auto take = [](size_t lane) -> std::shared_ptr<LaneTask> {
+    std::scoped_lock lock(lanes_mutex_);
+    if (lanes_[lane].empty()) {
+      return nullptr;
+    }
+    auto task = std::move(lanes_[lane].front());
+    lanes_[lane].pop_front();
+    if (!task->key.empty()) {
+      keyed_tasks_.erase(task->key);
+    }
+    return task;
+  };
+
+  size_t urgent = 0;
+  {
+    std::scoped_lock lock(lanes_mutex_);
+    urgent = lanes_[0].size();
+  }
+
+  // A callback may cancel or re-key a counted task, so the lane can run dry early
+  bool ok = true;
+  for (size_t i = 0; ok && i < urgent; i++) {
+    auto task = take(0);
+    if (!task) break;
+    ok = RunLaneTask(env, std::move(task));
+  }
+
+  uint64_t start = tracing::Now();
+  while (ok && tracing::Now() - start < kNormalSlice) {
+    auto task = take(1);
+    if (!task) break;
+    ok = RunLaneTask(env, std::move(task));
+  }
+
+  start = tracing::Now();
+  for (bool first = true; ok && (first || tracing::Now() - start < kBackgroundSlice); first = false) {
+    auto task = take(2);
+    if (!task) break;
+    ok = RunLaneTask(env, std::move(task));
+  }
+
+  if (!LanesEmpty()) {
+    ScheduleDrain();
+  }
+}
 
+bool Application::LanesEmpty() {
+  std::scoped_lock lock(lanes_mutex_);
+  return lanes_[0].empty() && lanes_[1].empty() && lanes_[2].empty();
+}
+
+// The lanes are static but their tasks hold references into the env: drop pending callbacks and deferreds and the
+// shared TSFN when the application goes away or the env tears down, never at static destruction
+void Application::ReleaseLanes() {
+  std::array<std::deque<std::shared_ptr<LaneTask>>, 3> dropped;
+  {
+    std::scoped_lock lock(lanes_mutex_);
+    dropped.swap(lanes_);
+    keyed_tasks_.clear();
+  }
+
+  drain_posted_ = false;
+  drain_ready_ = false;
+  manual_lanes_ = false;
+
+  if (lanes_env_) {
+    napi_remove_env_cleanup_hook(lanes_env_, &Application::OnLanesEnvCleanup, nullptr);
+    lanes_env_ = nullptr;
+  }
+
+  if (lane_tsfn_) {
+    lane_tsfn_.Release();
+    lane_tsfn_ = Napi::ThreadSafeFunction();
+  }
+}
+
+void Application::OnLanesEnvCleanup(void*) {
+  lanes_env_ = nullptr;
+  ReleaseLanes();
+}
+
+// Returns false when a post() callback threw; the exception is left pending for Node to report
+bool Application::RunLaneTask(Napi::Env env, std::shared_ptr<LaneTask> task) {
+  Napi::HandleScope scope(env);
+  metrics::loop_tasks.Add();
+  tracing::Span("tsfn", task->deferred ? "dispatch" : "post", task->queued);
+
+  bool ok = true;
+
+  try {
+    Napi::Value result = task->callback.Value().Call({});
+    if (task->deferred) {
+      task->deferred->Resolve(result);
+    }
+  } catch (const Napi::Error& err) {
+    if (task->deferred) {
+      task->deferred->Reject(err.Value());
+    } else {
+      err.ThrowAsJavaScriptException();
+      ok = false;
+    }
+  } catch (...) {
+    if (task->deferred) {
+      task->deferred->Reject(Napi::String::New(env, "dispatch callback failed"));
+    } else {
+      Napi::Error::New(env, "post callback failed").ThrowAsJavaScriptException();
+      ok = false;
+    }
+  }
+
+  task->callback.Reset();
+  return ok;
 }
 
 
@@ -1610,12 +2760,14 @@ void Application::ProcessPoolTask() {
 
 
 
-  task->tsfn.NonBlockingCall(holder,
+  napi_status status = task->tsfn.NonBlockingCall(holder,
 
     [](Napi::Env env, Napi::Function jsCallback, std::shared_ptr<PoolTask>* holder) {
 
       auto& data = **holder;
 
+      tracing::Span("tsfn", "pool", data.queued);
+
       Napi::HandleScope scope(env);
 
       try {
@@ -1654,6 +2806,8 @@ void Application::ProcessPoolTask() {
 
     });
 
+  metrics::TrackCall(status == napi_ok);
+
 }
 
 
@@ -1672,6 +2826,14 @@ std::mutex Webview::instance_mutex_;
 
 
 
+std::mutex Webview::rpc_pool_mutex_;
+
+std::vector<std::unique_ptr<Webview::RpcCall>> Webview::rpc_calls_;
+
+std::vector<uint32_t> Webview::rpc_free_;
+
+
+
 static bool MapWindowEventName(const std::string& name, SAUCER_WINDOW_EVENT& out) {
 
   if (name == "decorated") { out = SAUCER_WINDOW_EVENT_DECORATED; return true; }
@@ -1748,6 +2910,8 @@ Napi::Object Webview::Init(Napi::Env env, Napi::Object exports) {
     InstanceAccessor("position", &Webview::GetPosition, &Webview::SetPosition),
     InstanceAccessor("fullscreen", &Webview::GetFullscreen, &Webview::SetFullscreen),
     InstanceAccessor("zoom", &Webview::GetZoom, &Webview::SetZoom),
+    InstanceMethod("getGeometry", &Webview::GetGeometry),
+    InstanceMethod("apply", &Webview::Apply),
 
     InstanceAccessor("parent", &Webview::GetParent, nullptr),
 
@@ -1824,6 +2988,8 @@ Napi::Object Webview::Init(Napi::Env env, Napi::Object exports) {
 
     StaticMethod("registerScheme", &Webview::RegisterScheme),
 
+    StaticMethod("setRpcSettle", &Webview::SetRpcSettle),
+
 
 
     // Event handling
@@ -1840,10 +3006,6 @@ Napi::Object Webview::Init(Napi::Env env, Napi::Object exports) {
 
 
 
-  Napi::FunctionReference* constructor = new Napi::FunctionReference();
-
-  *constructor = Napi::Persistent(func);
-
   exports.Set("Webview", func);
 
   return exports;
@@ -1945,18 +3107,67 @@ Webview::Webview(const Napi::CallbackInfo& info)
 
     }
 
+    // Share one web context (storage / network process) with other webviews of the same group
+    if (opts.Has("sharedContext")) {
+      Napi::Value shared = opts.Get("sharedContext");
+      if (shared.IsString()) {
+        std::string group = shared.As<Napi::String>().Utf8Value();
+        saucer_preferences_set_shared_context(prefs, group.c_str());
+      } else if (shared.IsBoolean() && shared.As<Napi::Boolean>().Value()) {
+        saucer_preferences_set_shared_context(prefs, "default");
+      }
+    }
+
+    if (opts.Has("cacheModel") && opts.Get("cacheModel").IsString()) {
+      std::string model = opts.Get("cacheModel").As<Napi::String>().Utf8Value();
+      if (model == "documentViewer") {
+        saucer_preferences_set_cache_model(prefs, SAUCER_CACHE_MODEL_DOCUMENT_VIEWER);
+      } else if (model == "documentBrowser") {
+        saucer_preferences_set_cache_model(prefs, SAUCER_CACHE_MODEL_DOCUMENT_BROWSER);
+      } else if (model == "webBrowser") {
+        saucer_preferences_set_cache_model(prefs, SAUCER_CACHE_MODEL_WEB_BROWSER);
+      } else if (model != "default") {
+        saucer_preferences_free(prefs);
+        Napi::TypeError::New(env, "cacheModel must be one of: default, documentViewer, documentBrowser, webBrowser")
+            .ThrowAsJavaScriptException();
+        return;
+      }
+    }
+
+    if (opts.Has("processLimit") && opts.Get("processLimit").IsNumber()) {
+      int64_t limit = opts.Get("processLimit").As<Napi::Number>().Int64Value();
+      if (limit > 0) {
+        saucer_preferences_set_process_limit(prefs, static_cast<size_t>(limit));
+      }
+    }
+
     // Store preload script for injection after webview creation
     if (opts.Has("preload") && opts.Get("preload").IsString()) {
       preload_script_ = opts.Get("preload").As<Napi::String>().Utf8Value();
     }
 
+    // The page-side batching script is injected from JS; natively only the demultiplexer is needed
+    rpc_batching_ = opts.Has("rpcBatching") && opts.Get("rpcBatching").IsString();
+
   }
 
 
 
   // Create webview
 
-  webview_ = saucer_new(prefs);
+  std::string context_error;
+  if (!::saucer_webview_begin_context_ext(prefs, &context_error)) {
+    saucer_preferences_free(prefs);
+    Napi::TypeError::New(env, context_error).ThrowAsJavaScriptException();
+    return;
+  }
+
+  {
+    StartupTimeline::Span span("saucer_new");
+    webview_ = saucer_new(prefs);
+  }
+
+  ::saucer_webview_end_context_ext();
 
   saucer_preferences_free(prefs);
 
@@ -1982,6 +3193,17 @@ Webview::Webview(const Napi::CallbackInfo& info)
     saucer_script_set_frame(script, SAUCER_WEB_FRAME_TOP);
     saucer_webview_inject(webview_, script);
     saucer_script_free(script);
+    StartupTimeline::Mark("webview.preload");
+  }
+
+  if (rpc_batching_) {
+    ExposeBatch();
+  }
+
+  // Until the first page is ready, record its load milestones regardless of JS listeners
+  if (!StartupTimeline::Complete()) {
+    startup_load_listener_ = saucer_webview_on(webview_, SAUCER_WEB_EVENT_LOAD, reinterpret_cast<void*>(&Webview::OnStartupLoad));
+    saucer_webview_once(webview_, SAUCER_WEB_EVENT_DOM_READY, reinterpret_cast<void*>(&Webview::OnStartupDomReady));
   }
 
 
@@ -2371,9 +3593,253 @@ Napi::Value Webview::GetZoom(const Napi::CallbackInfo& info) {
   return Napi::Number::New(info.Env(), zoom);
 }
 
-void Webview::SetZoom(const Napi::CallbackInfo& info, const Napi::Value& value) {
-  double level = value.As<Napi::Number>().DoubleValue();
-  ::saucer_webview_set_zoom_ext(webview_, level);
+void Webview::SetZoom(const Napi::CallbackInfo& info, const Napi::Value& value) {
+  double level = value.As<Napi::Number>().DoubleValue();
+  ::saucer_webview_set_zoom_ext(webview_, level);
+}
+
+Napi::Value Webview::GetGeometry(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  int x = 0, y = 0, width = 0, height = 0;
+  ::saucer_window_position_ext(webview_, &x, &y);
+  saucer_window_size(webview_, &width, &height);
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("x", Napi::Number::New(env, x));
+  result.Set("y", Napi::Number::New(env, y));
+  result.Set("width", Napi::Number::New(env, width));
+  result.Set("height", Napi::Number::New(env, height));
+  result.Set("fullscreen", Napi::Boolean::New(env, ::saucer_window_fullscreen_ext(webview_)));
+  result.Set("maximized", Napi::Boolean::New(env, saucer_window_maximized(webview_)));
+  result.Set("minimized", Napi::Boolean::New(env, saucer_window_minimized(webview_)));
+  result.Set("zoom", Napi::Number::New(env, ::saucer_webview_zoom_ext(webview_)));
+  return result;
+}
+
+void Webview::Apply(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() == 0 || !info[0].IsObject()) {
+    Napi::TypeError::New(env, "Usage: apply({ title?, size?, minSize?, maxSize?, position?, ... })").ThrowAsJavaScriptException();
+    return;
+  }
+
+  struct Extent {
+    int width;
+    int height;
+  };
+
+  struct Changes {
+    std::optional<std::string> title;
+    std::optional<Extent> size, min_size, max_size;
+    std::optional<std::pair<int, int>> position;
+    std::optional<bool> resizable, decorations, always_on_top, click_through;
+    std::optional<bool> maximized, minimized, fullscreen, visible;
+    std::optional<bool> dev_tools, context_menu, force_dark_mode;
+    std::optional<std::array<uint8_t, 4>> background;
+    std::optional<double> zoom;
+  } changes;
+
+  // Phase 1: validate everything; nothing is touched unless the whole object is valid
+
+  auto fail = [&](const std::string& message) {
+    Napi::TypeError::New(env, "apply(): " + message).ThrowAsJavaScriptException();
+  };
+
+  auto readExtent = [&](const std::string& key, Napi::Value value, std::optional<Extent>& target) {
+    if (!value.IsObject()) {
+      fail(key + " must be an object with width and height");
+      return false;
+    }
+
+    Napi::Object obj = value.As<Napi::Object>();
+    if (!obj.Get("width").IsNumber() || !obj.Get("height").IsNumber()) {
+      fail(key + " must be an object with numeric width and height");
+      return false;
+    }
+
+    target = Extent{obj.Get("width").As<Napi::Number>().Int32Value(), obj.Get("height").As<Napi::Number>().Int32Value()};
+    if (target->width < 0 || target->height < 0) {
+      fail(key + " must not be negative");
+      return false;
+    }
+
+    return true;
+  };
+
+  auto readBool = [&](const std::string& key, Napi::Value value, std::optional<bool>& target) {
+    if (!value.IsBoolean()) {
+      fail(key + " must be a boolean");
+      return false;
+    }
+
+    target = value.As<Napi::Boolean>().Value();
+    return true;
+  };
+
+  Napi::Object props = info[0].As<Napi::Object>();
+  Napi::Array keys = props.GetPropertyNames();
+
+  for (uint32_t i = 0; i < keys.Length(); ++i) {
+    std::string key = keys.Get(i).As<Napi::String>().Utf8Value();
+    Napi::Value value = props.Get(key);
+    bool ok = true;
+
+    if (value.IsUndefined()) {
+      continue;
+    }
+
+    if (key == "title") {
+      if (!value.IsString()) {
+        fail("title must be a string");
+        return;
+      }
+      changes.title = value.As<Napi::String>().Utf8Value();
+    } else if (key == "size") {
+      ok = readExtent(key, value, changes.size);
+    } else if (key == "minSize") {
+      ok = readExtent(key, value, changes.min_size);
+    } else if (key == "maxSize") {
+      ok = readExtent(key, value, changes.max_size);
+    } else if (key == "position") {
+      if (!value.IsObject() || !value.As<Napi::Object>().Get("x").IsNumber() || !value.As<Napi::Object>().Get("y").IsNumber()) {
+        fail("position must be an object with numeric x and y");
+        return;
+      }
+      if (!::saucer_window_position_supported_ext(webview_)) {
+        fail("position is not supported by this platform's window system");
+        return;
+      }
+      Napi::Object pos = value.As<Napi::Object>();
+      changes.position = std::make_pair(pos.Get("x").As<Napi::Number>().Int32Value(), pos.Get("y").As<Napi::Number>().Int32Value());
+    } else if (key == "backgroundColor") {
+      if (!value.IsArray() || value.As<Napi::Array>().Length() < 4) {
+        fail("backgroundColor must be an array [r, g, b, a]");
+        return;
+      }
+      Napi::Array arr = value.As<Napi::Array>();
+      std::array<uint8_t, 4> rgba{};
+      for (uint32_t c = 0; c < 4; ++c) {
+        if (!arr.Get(c).IsNumber()) {
+          fail("backgroundColor components must be numbers");
+          return;
+        }
+        rgba[c] = static_cast<uint8_t>(arr.Get(c).As<Napi::Number>().Uint32Value());
+      }
+      changes.background = rgba;
+    } else if (key == "zoom") {
+      if (!value.IsNumber() || value.As<Napi::Number>().DoubleValue() <= 0) {
+        fail("zoom must be a positive number");
+        return;
+      }
+      changes.zoom = value.As<Napi::Number>().DoubleValue();
+    } else if (key == "resizable") {
+      ok = readBool(key, value, changes.resizable);
+    } else if (key == "decorations") {
+      ok = readBool(key, value, changes.decorations);
+    } else if (key == "alwaysOnTop") {
+      ok = readBool(key, value, changes.always_on_top);
+    } else if (key == "clickThrough") {
+      ok = readBool(key, value, changes.click_through);
+    } else if (key == "maximized") {
+      ok = readBool(key, value, changes.maximized);
+    } else if (key == "minimized") {
+      ok = readBool(key, value, changes.minimized);
+    } else if (key == "fullscreen") {
+      ok = readBool(key, value, changes.fullscreen);
+    } else if (key == "visible") {
+      ok = readBool(key, value, changes.visible);
+    } else if (key == "devTools") {
+      ok = readBool(key, value, changes.dev_tools);
+    } else if (key == "contextMenu") {
+      ok = readBool(key, value, changes.context_menu);
+    } else if (key == "forceDarkMode") {
+      ok = readBool(key, value, changes.force_dark_mode);
+    } else {
+      fail("unknown property \"" + key + "\"");
+      return;
+    }
+
+    if (!ok) {
+      return;
+    }
+  }
+
+  if (changes.min_size && changes.max_size &&
+      (changes.min_size->width > changes.max_size->width || changes.min_size->height > changes.max_size->height)) {
+    fail("minSize must not exceed maxSize");
+    return;
+  }
+
+  // Phase 2: apply in one pass without returning to the event loop. Decorations/resizability go first since
+  // they change the frame, then constraints, size and position as one native geometry update where the
+  // platform has one (otherwise constraints before the size they clamp), then the webview settings.
+  // Visibility comes next: maximize, fullscreen and minimize only take effect on a shown window on some
+  // platforms, so they are applied after it. Each setter still queues its own platform update.
+
+  if (changes.title) saucer_window_set_title(webview_, changes.title->c_str());
+  if (changes.decorations) saucer_window_set_decorations(webview_, *changes.decorations);
+  if (changes.resizable) saucer_window_set_resizable(webview_, *changes.resizable);
+  if (changes.always_on_top) saucer_window_set_always_on_top(webview_, *changes.always_on_top);
+  if (changes.click_through) saucer_window_set_click_through(webview_, *changes.click_through);
+
+  saucer_window_geometry_ext geometry;
+  auto toPair = [](const std::optional<Extent>& extent) {
+    return extent ? std::optional<std::pair<int, int>>{{extent->width, extent->height}} : std::nullopt;
+  };
+
+  geometry.min_size = toPair(changes.min_size);
+  geometry.max_size = toPair(changes.max_size);
+
+  // A hint set replaces both bounds, so carry the current one over when only the other changes
+  if (geometry.min_size && !geometry.max_size) {
+    int width = 0, height = 0;
+    saucer_window_max_size(webview_, &width, &height);
+    geometry.max_size = std::make_pair(width, height);
+  } else if (geometry.max_size && !geometry.min_size) {
+    int width = 0, height = 0;
+    saucer_window_min_size(webview_, &width, &height);
+    geometry.min_size = std::make_pair(width, height);
+  }
+  geometry.size = toPair(changes.size);
+  geometry.position = changes.position;
+
+  if (!::saucer_window_set_geometry_ext(webview_, geometry)) {
+    if (changes.min_size) saucer_window_set_min_size(webview_, changes.min_size->width, changes.min_size->height);
+    if (changes.max_size) saucer_window_set_max_size(webview_, changes.max_size->width, changes.max_size->height);
+    if (changes.size) saucer_window_set_size(webview_, changes.size->width, changes.size->height);
+    if (changes.position) ::saucer_window_set_position_ext(webview_, changes.position->first, changes.position->second);
+  }
+
+  if (changes.background) {
+    const auto& c = *changes.background;
+    saucer_webview_set_background(webview_, c[0], c[1], c[2], c[3]);
+  }
+  if (changes.zoom) ::saucer_webview_set_zoom_ext(webview_, *changes.zoom);
+  if (changes.dev_tools) saucer_webview_set_dev_tools(webview_, *changes.dev_tools);
+  if (changes.context_menu) saucer_webview_set_context_menu(webview_, *changes.context_menu);
+  if (changes.force_dark_mode) saucer_webview_set_force_dark_mode(webview_, *changes.force_dark_mode);
+
+  if (changes.visible) {
+    if (*changes.visible) {
+      saucer_window_show(webview_);
+    } else {
+      saucer_window_hide(webview_);
+    }
+  }
+
+  if (changes.maximized) saucer_window_set_maximized(webview_, *changes.maximized);
+  if (changes.fullscreen) ::saucer_window_set_fullscreen_ext(webview_, *changes.fullscreen);
+  if (changes.minimized) {
+    // Same as the minimized setter: macOS refuses to miniaturize an invisible window
+    if (*changes.minimized && !saucer_window_visible(webview_)) {
+      saucer_window_show(webview_);
+    }
+    saucer_window_set_minimized(webview_, *changes.minimized);
+    minimized_hint_ = *changes.minimized;
+    minimized_hint_valid_ = true;
+  }
 }
 
 
@@ -2412,10 +3878,23 @@ void Webview::Hide(const Napi::CallbackInfo& info) {
 
 void Webview::Close(const Napi::CallbackInfo& info) {
 
+  // A PDF export still rendering from this view would be left printing a closed window; close once it is done
+  if (pending_exports_ > 0) {
+    close_after_exports_ = true;
+    return;
+  }
+
   saucer_window_close(webview_);
 
 }
 
+void Webview::EndExport() {
+  if (--pending_exports_ == 0 && close_after_exports_) {
+    close_after_exports_ = false;
+    saucer_window_close(webview_);
+  }
+}
+
 void Webview::Focus(const Napi::CallbackInfo& info) {
   saucer_window_focus(webview_);
 }
@@ -2661,7 +4140,7 @@ void Webview::Execute(const Napi::CallbackInfo& info) {
 
 
 
-  std::vector<glz::json_t> args;
+  std::vector<glz::raw_json> args;
 
   try {
 
@@ -2930,16 +4409,17 @@ void Webview::Embed(const Napi::CallbackInfo& info) {
     if (!fileVal.IsObject()) continue;
     Napi::Object file = fileVal.As<Napi::Object>();
 
-    // Get content - can be string or Buffer
+    // Get content - can be string or Buffer. Content is deduplicated process-wide, so the same bundle embedded
+    // into several webviews is only held in memory once.
     saucer_stash* stash = nullptr;
     if (file.Has("content")) {
       Napi::Value contentVal = file.Get("content");
       if (contentVal.IsString()) {
         std::string content = contentVal.As<Napi::String>().Utf8Value();
-        stash = saucer_stash_from(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+        stash = saucer_stash_new_shared(reinterpret_cast<const uint8_t*>(content.data()), content.size());
       } else if (contentVal.IsBuffer()) {
         Napi::Buffer<uint8_t> buf = contentVal.As<Napi::Buffer<uint8_t>>();
-        stash = saucer_stash_from(buf.Data(), buf.Length());
+        stash = saucer_stash_new_shared(buf.Data(), buf.Length());
       }
     }
 
@@ -3006,6 +4486,7 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
 
   auto scheme_entry = std::make_shared<SchemeHandler>();
   scheme_entry->name = name;
+  scheme_entry->metrics = &metrics::ForScheme(name);
   scheme_entry->tsfn = std::make_shared<Napi::ThreadSafeFunction>(
     Napi::ThreadSafeFunction::New(
       env,
@@ -3054,6 +4535,8 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
         return;
       }
 
+      handler_entry->metrics->requests.Add();
+
       // Build request object for JS
       char* method = saucer_scheme_request_method(request);
       std::string methodStr = method ? method : "GET";
@@ -3089,6 +4572,9 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
         std::vector<uint8_t> content;
         std::vector<std::pair<std::string, std::string>> headers;
         saucer_scheme_executor* executor;
+        std::string scheme;
+        metrics::SchemeMetrics* metrics;
+        uint64_t started;
       };
 
       auto* payload = new SchemePayload{
@@ -3096,10 +4582,13 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
         std::move(methodStr),
         std::move(contentData),
         std::move(headers),
-        executor
+        executor,
+        handler_entry->name,
+        handler_entry->metrics,
+        tracing::Now()
       };
 
-      handler_entry->tsfn->NonBlockingCall(payload,
+      napi_status status = handler_entry->tsfn->NonBlockingCall(payload,
         [](Napi::Env env, Napi::Function jsCallback, SchemePayload* data) {
           Napi::HandleScope scope(env);
 
@@ -3120,7 +4609,10 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
           }
           reqObj.Set("headers", headersObj);
 
-          auto resolveResponse = [env, executor = data->executor](Napi::Value result) {
+          auto resolveResponse = [env, executor = data->executor, scheme = data->scheme, scheme_metrics = data->metrics, started = data->started](Napi::Value result) {
+            tracing::Span("scheme", scheme, started);
+            scheme_metrics->latency.Record(tracing::Now() - started);
+
             if (result.IsObject()) {
               Napi::Object resObj = result.As<Napi::Object>();
 
@@ -3143,6 +4635,8 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
                 return;
               }
 
+              scheme_metrics->bytes.Add(saucer_stash_size(stash));
+
               std::string mime = "text/html";
               if (resObj.Has("mime") && resObj.Get("mime").IsString()) {
                 mime = resObj.Get("mime").As<Napi::String>().Utf8Value();
@@ -3175,7 +4669,9 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
             saucer_scheme_executor_free(executor);
           };
 
-          auto rejectResponse = [executor = data->executor](SAUCER_SCHEME_ERROR error) {
+          auto rejectResponse = [executor = data->executor, scheme = data->scheme, scheme_metrics = data->metrics, started = data->started](SAUCER_SCHEME_ERROR error) {
+            tracing::Span("scheme", scheme, started);
+            scheme_metrics->latency.Record(tracing::Now() - started);
             saucer_scheme_executor_reject(executor, error);
             saucer_scheme_executor_free(executor);
           };
@@ -3214,6 +4710,14 @@ void Webview::HandleScheme(const Napi::CallbackInfo& info) {
           delete data;
         }
       );
+
+      metrics::TrackCall(status == napi_ok);
+
+      if (status != napi_ok) {
+        saucer_scheme_executor_reject(payload->executor, SAUCER_REQUEST_ERROR_FAILED);
+        saucer_scheme_executor_free(payload->executor);
+        delete payload;
+      }
     },
     policy
   );
@@ -3445,27 +4949,72 @@ void Webview::Expose(const Napi::CallbackInfo& info) {
 
 
 
+  // { raw: true | "buffer" }: hand the arguments over as unparsed JSON text
+  bool raw = false;
+
+  bool raw_buffer = false;
+
+  if (info.Length() > 2 && info[2].IsObject()) {
+
+    Napi::Value raw_option = info[2].As<Napi::Object>().Get("raw");
+
+    raw_buffer = raw_option.IsString() && raw_option.As<Napi::String>().Utf8Value() == "buffer";
+
+    raw = raw_buffer || raw_option.ToBoolean().Value();
+
+
+
+    // The raw path always dispatches through the TSFN and awaits promise results itself
+
+    Napi::Object options = info[2].As<Napi::Object>();
+
+    if (raw && (!options.Get("launch").IsUndefined() || !options.Get("async").IsUndefined())) {
+
+      Napi::TypeError::New(env, "expose(): the raw option cannot be combined with launch or async").ThrowAsJavaScriptException();
+
+      return;
+
+    }
+
+  }
+
+
+
   auto exposed_entry = std::make_shared<ExposedCallback>();
 
   exposed_entry->name = name;
 
-  exposed_entry->tsfn = std::make_shared<Napi::ThreadSafeFunction>(
+  exposed_entry->metrics = &metrics::ForRpc(name);
 
-    Napi::ThreadSafeFunction::New(
+  // Raw handlers use closures per call; the regular path hands pooled call records straight
+  // to a TSFN whose call_js is CallExposed, so node-addon-api allocates no wrapper per call
+  exposed_entry->raw = raw;
 
-      env,
+  if (raw) {
 
-      cb,
+    exposed_entry->tsfn = std::make_shared<Napi::ThreadSafeFunction>(
 
-      "saucer.webview.expose",
+      Napi::ThreadSafeFunction::New(env, cb, "saucer.webview.expose", 0, 1)
 
-      0,
+    );
 
-      1
+  } else {
 
-    )
+    napi_threadsafe_function tsfn = nullptr;
 
-  );
+    napi_status status = napi_create_threadsafe_function(env, cb, nullptr, Napi::String::New(env, "saucer.webview.expose"), 0, 1, nullptr, nullptr, nullptr, &Webview::CallExposed, &tsfn);
+
+    if (status != napi_ok) {
+
+      Napi::Error::New(env, "Failed to create RPC dispatcher").ThrowAsJavaScriptException();
+
+      return;
+
+    }
+
+    exposed_entry->tsfn = std::make_shared<Napi::ThreadSafeFunction>(tsfn);
+
+  }
 
 
 
@@ -3479,6 +5028,16 @@ void Webview::Expose(const Napi::CallbackInfo& info) {
 
 
 
+  if (raw) {
+
+    ExposeRaw(handle, std::move(name), exposed_entry, raw_buffer);
+
+    return;
+
+  }
+
+
+
   using RpcExecutor = saucer::executor<glz::json_t>;
 
   handle->expose(
@@ -3487,156 +5046,455 @@ void Webview::Expose(const Napi::CallbackInfo& info) {
 
     [entry = exposed_entry](std::vector<glz::json_t> params, const RpcExecutor& exec) {
 
-      auto executor = std::make_shared<RpcExecutor>(exec);
+      RpcCall* call = AcquireRpcCall();
 
-      auto params_json = glz::write_json(params).value_or("[]");
+      call->entry = entry;
 
-      auto* payload = new std::tuple<std::shared_ptr<Napi::ThreadSafeFunction>, std::shared_ptr<RpcExecutor>, std::string>{
+      call->executor.emplace(exec);
 
-        entry->tsfn,
-
-        executor,
+      call->queued = tracing::Timestamp();
 
-        std::move(params_json)
+      call->received = tracing::Now();
 
-      };
+      // Serialize into the record's buffer, whose capacity survives recycling
+      call->params.clear();
 
+      if (glz::write_json(params, call->params)) {
 
+        call->params = "[]";
 
-      auto status = entry->tsfn->NonBlockingCall(
+      }
 
-        payload,
+      entry->metrics->calls.Add();
 
-        [](Napi::Env env, Napi::Function jsCallback, std::tuple<std::shared_ptr<Napi::ThreadSafeFunction>, std::shared_ptr<RpcExecutor>, std::string>* data) {
 
-          auto [tsfn, executor, params] = *data;
 
-          delete data;
+      napi_status status = napi_call_threadsafe_function(*entry->tsfn, call, napi_tsfn_nonblocking);
 
+      metrics::TrackCall(status == napi_ok);
 
 
-          auto reject_with = [&](Napi::Value reason) {
-            try {
-              executor->reject(Webview::StringifyForRPC(env, reason));
-            } catch (const Napi::Error& err) {
-              executor->reject(Webview::StringifyForRPC(env, err.Value()));
-            } catch (...) {
-              executor->reject("Unhandled RPC rejection");
-            }
-          };
 
+      if (status != napi_ok) {
 
+        RejectRpcCall(call, "Failed to dispatch RPC to JavaScript");
 
-          auto resolve_with = [&](Napi::Value value) {
-            try {
-              executor->resolve(Webview::SerializeForRPC(env, value));
-            } catch (const Napi::Error& err) {
-              executor->reject(Webview::StringifyForRPC(env, err.Value()));
-            } catch (...) {
-              executor->reject("Failed to serialize RPC result");
-            }
-          };
+      }
 
+    }
 
+  );
 
-          try {
+}
 
-            Napi::Value parsed = Webview::ParseJson(env, params);
 
-            std::vector<napi_value> args;
 
-            if (parsed.IsArray()) {
+// ============================================================================
+// Pooled RPC calls - one record per in-flight exposed call, recycled after it settles.
+// Records and their params buffers are reused; copying saucer's executor into a record
+// still allocates, as does serializing the values. Promise results are settled through
+// lib/rpc-settle.js's helper and two trampolines kept per env in AddonData; the call id
+// travels as an argument, so no native function is created per call.
+// ============================================================================
 
-              Napi::Array arr = parsed.As<Napi::Array>();
+Webview::RpcCall* Webview::AcquireRpcCall() {
+  std::scoped_lock lock(rpc_pool_mutex_);
 
-              uint32_t len = arr.Length();
+  if (rpc_free_.empty()) {
+    auto call = std::make_unique<RpcCall>();
+    call->slot = static_cast<uint32_t>(rpc_calls_.size());
+    rpc_calls_.push_back(std::move(call));
+    rpc_free_.push_back(rpc_calls_.back()->slot);
+    metrics::rpc_call_records.Add();
+  }
 
-              args.reserve(len);
+  uint32_t slot = rpc_free_.back();
+  rpc_free_.pop_back();
+  return rpc_calls_[slot].get();
+}
 
-              for (uint32_t i = 0; i < len; ++i) {
+// Call ids pack the slot with a generation, so a late settle for a recycled record is ignored
+double Webview::RpcCallId(const RpcCall* call) {
+  return static_cast<double>((static_cast<uint64_t>(call->generation) << 24) | call->slot);
+}
 
-                args.push_back(arr.Get(i));
+Webview::RpcCall* Webview::FindRpcCall(double id) {
+  uint64_t value = static_cast<uint64_t>(id);
+  uint32_t slot = static_cast<uint32_t>(value & 0xFFFFFF);
+  uint32_t generation = static_cast<uint32_t>(value >> 24);
 
-              }
+  std::scoped_lock lock(rpc_pool_mutex_);
+  if (slot >= rpc_calls_.size() || rpc_calls_[slot]->generation != generation || !rpc_calls_[slot]->entry) {
+    return nullptr;
+  }
+  return rpc_calls_[slot].get();
+}
 
-            } else if (!parsed.IsUndefined() && !parsed.IsNull()) {
+void Webview::ResolveRpcCall(RpcCall* call, glz::json_t value) {
+  if (call->batch) {
+    glz::json_t result;
+    result["ok"] = true;
+    result["value"] = std::move(value);
+    CompleteBatchItem(call, std::move(result));
+  } else {
+    call->executor->resolve(std::move(value));
+  }
+  RecycleRpcCall(call, true);
+}
 
-              args.push_back(parsed);
+void Webview::RejectRpcCall(RpcCall* call, std::string reason) {
+  if (call->batch) {
+    glz::json_t result;
+    result["ok"] = false;
+    result["error"] = std::move(reason);
+    CompleteBatchItem(call, std::move(result));
+  } else {
+    call->executor->reject(std::move(reason));
+  }
+  RecycleRpcCall(call, false);
+}
 
-            }
+// The batch resolves once, with one { ok, value | error } per call in page order
+void Webview::CompleteBatchItem(RpcCall* call, glz::json_t result) {
+  RpcBatch& batch = *call->batch;
+  std::unique_lock lock(batch.mutex);
 
+  batch.results[call->index] = std::move(result);
+  if (--batch.remaining > 0) {
+    return;
+  }
 
+  glz::json_t results;
+  results.data = std::move(batch.results);
+  auto executor = std::move(batch.executor);
+  lock.unlock();
 
-            Napi::Value result = jsCallback.Call(args);
+  executor->resolve(std::move(results));
+}
 
-            if (result.IsPromise()) {
+void Webview::RecycleRpcCall(RpcCall* call, bool ok) {
+  auto& metrics = *call->entry->metrics;
+  metrics.latency.Record(tracing::Now() - call->received);
+  if (!ok) {
+    metrics.errors.Add();
+  }
 
-              auto promise = result.As<Napi::Promise>();
+  call->executor.reset();
+  call->batch.reset();
 
+  // FindRpcCall reads entry under the lock, so clear it there too
+  std::scoped_lock lock(rpc_pool_mutex_);
+  call->entry.reset();
+  call->generation = (call->generation + 1) & 0xFFFFFF;
+  rpc_free_.push_back(call->slot);
+}
 
+// Trampolines called by the settle helper as ok(id, value) / fail(id, reason)
+void Webview::SettleRpcCall(const Napi::CallbackInfo& info, bool ok) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 0 || !info[0].IsNumber()) {
+    return;
+  }
 
-              auto on_resolve = Napi::Function::New(env, [executor](const Napi::CallbackInfo& info) {
+  RpcCall* call = FindRpcCall(info[0].As<Napi::Number>().DoubleValue());
+  if (!call) {
+    return;
+  }
 
-                Napi::Env env = info.Env();
+  Napi::Value value = info.Length() > 1 ? info[1] : env.Undefined();
+  try {
+    if (ok) {
+      ResolveRpcCall(call, SerializeForRPC(env, value));
+    } else {
+      RejectRpcCall(call, StringifyForRPC(env, value));
+    }
+  } catch (const Napi::Error& err) {
+    RejectRpcCall(call, StringifyForRPC(env, err.Value()));
+  }
+}
 
-                Napi::Value val = info.Length() > 0 ? info[0] : env.Undefined();
+void Webview::OnRpcFulfilled(const Napi::CallbackInfo& info) {
+  SettleRpcCall(info, true);
+}
 
-                executor->resolve(Webview::SerializeForRPC(env, val));
+void Webview::OnRpcRejected(const Napi::CallbackInfo& info) {
+  SettleRpcCall(info, false);
+}
 
-                return env.Undefined();
+// Webview.setRpcSettle(helper) - index.js hands over lib/rpc-settle.js's helper once per env
+void Webview::SetRpcSettle(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-              });
+  if (info.Length() == 0 || !info[0].IsFunction()) {
+    Napi::TypeError::New(env, "setRpcSettle() requires a function").ThrowAsJavaScriptException();
+    return;
+  }
 
+  AddonData& data = GetAddonData(env);
+  data.rpc_settle = Napi::Persistent(info[0].As<Napi::Function>());
+  if (data.rpc_resolve.IsEmpty()) {
+    data.rpc_resolve = Napi::Persistent(Napi::Function::New<&Webview::OnRpcFulfilled>(env, "saucerRpcResolve"));
+    data.rpc_reject = Napi::Persistent(Napi::Function::New<&Webview::OnRpcRejected>(env, "saucerRpcReject"));
+  }
+}
 
+// call_js of the exposed-function TSFN: runs the handler for one pooled call record
+void Webview::CallExposed(napi_env raw_env, napi_value js_callback, void*, void* data) {
+  auto* call = static_cast<RpcCall*>(data);
 
-              auto on_reject = Napi::Function::New(env, [executor](const Napi::CallbackInfo& info) {
+  // The TSFN is being torn down (clearExposed/shutdown) with this call still queued
+  if (raw_env == nullptr || js_callback == nullptr) {
+    RejectRpcCall(call, "RPC handler was removed");
+    return;
+  }
 
-                Napi::Env env = info.Env();
+  Napi::Env env(raw_env);
+  Napi::HandleScope scope(env);
+  Napi::Function handler(raw_env, js_callback);
 
-                Napi::Value reason = info.Length() > 0 ? info[0] : env.Null();
+  tracing::Span("tsfn", call->entry->name, call->queued);
 
-                executor->reject(Webview::StringifyForRPC(env, reason));
+  try {
+    Napi::Value parsed = ParseJson(env, call->params);
+
+    // Small argument lists stay on the stack
+    constexpr uint32_t kInlineArgs = 8;
+    napi_value inline_args[kInlineArgs];
+    std::vector<napi_value> heap_args;
+    napi_value* args = inline_args;
+    uint32_t argc = 0;
+
+    if (parsed.IsArray()) {
+      Napi::Array array = parsed.As<Napi::Array>();
+      argc = array.Length();
+      if (argc > kInlineArgs) {
+        heap_args.resize(argc);
+        args = heap_args.data();
+      }
+      for (uint32_t i = 0; i < argc; ++i) {
+        args[i] = array.Get(i);
+      }
+    } else if (!parsed.IsUndefined() && !parsed.IsNull()) {
+      args[argc++] = parsed;
+    }
 
-                return env.Undefined();
+    uint64_t call_start = tracing::Timestamp();
+    Napi::Value result = handler.Call(argc, args);
+    tracing::Span("rpc", call->entry->name, call_start);
 
-              });
+    if (result.IsPromise()) {
+      AddonData& data = GetAddonData(env);
+      if (data.rpc_settle.IsEmpty()) {
+        RejectRpcCall(call, "Promise results need index.js to register the settle helper");
+        return;
+      }
 
+      data.rpc_settle.Call({ result, Napi::Number::New(env, RpcCallId(call)), data.rpc_resolve.Value(), data.rpc_reject.Value() });
+      return;
+    }
 
+    ResolveRpcCall(call, SerializeForRPC(env, result));
+  } catch (const Napi::Error& err) {
+    try {
+      RejectRpcCall(call, StringifyForRPC(env, err.Value()));
+    } catch (...) {
+      RejectRpcCall(call, "Unhandled RPC rejection");
+    }
+  } catch (...) {
+    RejectRpcCall(call, "Unexpected RPC error");
+  }
+}
 
-              promise.Then(on_resolve, on_reject);
 
-            } else {
 
-              resolve_with(result);
+// Demultiplexer for rpcBatching: the page sends [[name, args], ...] in one message and each
+// call is dispatched like a regular exposed call, sharing the batch's executor
+void Webview::ExposeBatch() {
+  auto* handle = static_cast<saucer_handle*>(webview_);
+  if (!handle) {
+    return;
+  }
 
-            }
+  using RpcExecutor = saucer::executor<glz::json_t>;
 
-          } catch (const Napi::Error& err) {
+  handle->expose("__saucer_batch", [this](std::vector<glz::json_t> params, const RpcExecutor& exec) {
+    auto batch = std::make_shared<RpcBatch>();
+    batch->executor.emplace(exec);
 
-            reject_with(err.Value());
+    if (params.empty() || !params[0].is_array() || params[0].get_array().empty()) {
+      if (params.empty() || !params[0].is_array()) {
+        batch->executor->reject("Malformed RPC batch");
+      } else {
+        glz::json_t empty;
+        empty.data = glz::json_t::array_t{};
+        batch->executor->resolve(std::move(empty));
+      }
+      return;
+    }
 
-          } catch (...) {
+    auto& calls = params[0].get_array();
+    batch->results.resize(calls.size());
+    batch->remaining = calls.size();
 
-            executor->reject("Unexpected RPC error");
+    uint64_t queued = tracing::Timestamp();
+    uint64_t received = tracing::Now();
 
-          }
+    for (size_t i = 0; i < calls.size(); ++i) {
+      auto& item = calls[i];
+      std::string name = item.is_array() && item.get_array().size() == 2 && item[0].is_string() ? item[0].get_string() : "";
 
+      std::shared_ptr<ExposedCallback> entry;
+      {
+        std::scoped_lock lock(exposed_mutex_);
+        auto it = std::find_if(exposed_callbacks_.rbegin(), exposed_callbacks_.rend(), [&name](const auto& cb) { return cb->name == name; });
+        if (it != exposed_callbacks_.rend()) {
+          entry = *it;
         }
+      }
 
-      );
+      RpcCall* call = AcquireRpcCall();
+      call->entry = entry ? entry : std::make_shared<ExposedCallback>();
+      call->batch = batch;
+      call->index = static_cast<uint32_t>(i);
+      call->queued = queued;
+      call->received = received;
+
+      if (!entry || entry->raw) {
+        if (!entry) {
+          call->entry->metrics = &metrics::ForRpc("__saucer_batch");
+        }
+        RejectRpcCall(call, entry ? "Raw handlers cannot be batched" : "Unknown exposed function: " + name);
+        continue;
+      }
 
+      call->params.clear();
+      if (glz::write_json(item[1], call->params)) {
+        call->params = "[]";
+      }
+      entry->metrics->calls.Add();
 
+      napi_status status = napi_call_threadsafe_function(*entry->tsfn, call, napi_tsfn_nonblocking);
+      metrics::TrackCall(status == napi_ok);
 
       if (status != napi_ok) {
+        RejectRpcCall(call, "Failed to dispatch RPC to JavaScript");
+      }
+    }
+  });
+}
 
-        executor->reject("Failed to dispatch RPC to JavaScript");
+// Raw passthrough: glaze reads each argument as glz::raw_json (validated, never parsed into a
+// tree) and the handler's string/Buffer result is written back verbatim
+void Webview::ExposeRaw(saucer_handle* handle, std::string name, std::shared_ptr<ExposedCallback> entry, bool as_buffer) {
+  using RawExecutor = saucer::executor<glz::raw_json>;
+  using RawCall = std::pair<std::shared_ptr<RawExecutor>, std::string>;
 
+  handle->expose(
+    std::move(name),
+    [entry, as_buffer](std::vector<glz::raw_json> params, const RawExecutor& exec) {
+      auto executor = std::make_shared<RawExecutor>(exec);
+      entry->metrics->calls.Add();
+
+      // Re-join the untouched argument texts into one JSON array
+      size_t size = 2;
+      for (const auto& param : params) {
+        size += param.str.size() + 1;
       }
 
-    }
+      std::string payload;
+      payload.reserve(size);
+      payload += '[';
+      for (size_t i = 0; i < params.size(); ++i) {
+        if (i > 0) {
+          payload += ',';
+        }
+        payload += params[i].str;
+      }
+      payload += ']';
 
-  );
+      auto* call = new RawCall{ executor, std::move(payload) };
+
+      auto status = entry->tsfn->NonBlockingCall(
+        call,
+        [entry, as_buffer, queued = tracing::Timestamp(), received = tracing::Now()](Napi::Env env, Napi::Function jsCallback, RawCall* call) {
+          std::unique_ptr<RawCall> owned(call);
+          auto executor = owned->first;
+
+          tracing::Span("tsfn", entry->name, queued);
+
+          auto settle = [entry, received](bool ok) {
+            entry->metrics->latency.Record(tracing::Now() - received);
+            if (!ok) {
+              entry->metrics->errors.Add();
+            }
+          };
 
+          auto on_resolve = [entry, executor, settle](Napi::Env env, Napi::Value value) {
+            std::string json;
+            try {
+              json = Webview::RawJsonForRPC(env, value);
+            } catch (const Napi::Error& err) {
+              settle(false);
+              executor->reject(Webview::StringifyForRPC(env, err.Value()));
+              return;
+            }
+
+            // Pre-serialized text goes into the page's resolve call verbatim, so it must parse
+            if (glz::validate_json(json)) {
+              settle(false);
+              executor->reject("Raw result of \"" + entry->name + "\" is not valid JSON");
+              return;
+            }
+
+            settle(true);
+            executor->resolve(glz::raw_json{ std::move(json) });
+          };
+
+          auto on_reject = [executor, settle](Napi::Env env, Napi::Value reason) {
+            settle(false);
+            executor->reject(Webview::StringifyForRPC(env, reason));
+          };
+
+          try {
+            const std::string& payload = owned->second;
+            Napi::Value args = as_buffer
+              ? Napi::Buffer<char>::Copy(env, payload.data(), payload.size()).As<Napi::Value>()
+              : Napi::String::New(env, payload).As<Napi::Value>();
+
+            uint64_t call_start = tracing::Timestamp();
+            Napi::Value result = jsCallback.Call({ args });
+            tracing::Span("rpc", entry->name, call_start);
+
+            if (!result.IsPromise()) {
+              on_resolve(env, result);
+              return;
+            }
+
+            result.As<Napi::Promise>().Then(
+              Napi::Function::New(env, [on_resolve](const Napi::CallbackInfo& info) {
+                on_resolve(info.Env(), info.Length() > 0 ? info[0] : info.Env().Undefined());
+              }),
+              Napi::Function::New(env, [on_reject](const Napi::CallbackInfo& info) {
+                on_reject(info.Env(), info.Length() > 0 ? info[0] : info.Env().Null());
+              })
+            );
+          } catch (const Napi::Error& err) {
+            on_reject(env, err.Value());
+          } catch (...) {
+            settle(false);
+            executor->reject("Unexpected RPC error");
+          }
+        }
+      );
+
+      metrics::TrackCall(status == napi_ok);
+
+      if (status != napi_ok) {
+        entry->metrics->errors.Add();
+        executor->reject("Failed to dispatch RPC to JavaScript");
+      }
+    }
+  );
 }
 
 void Webview::ClearExposed(const Napi::CallbackInfo& info) {
@@ -3681,9 +5539,19 @@ void Webview::ClearExposed(const Napi::CallbackInfo& info) {
 
     // Clear our tracking list
 
-    std::scoped_lock lock(exposed_mutex_);
+    {
 
-    exposed_callbacks_.clear();
+      std::scoped_lock lock(exposed_mutex_);
+
+      exposed_callbacks_.clear();
+
+    }
+
+    if (rpc_batching_) {
+
+      ExposeBatch();
+
+    }
 
   }
 
@@ -3721,7 +5589,7 @@ Napi::Value Webview::Evaluate(const Napi::CallbackInfo& info) {
 
   std::string code = info[0].As<Napi::String>().Utf8Value();
 
-  std::vector<glz::json_t> args;
+  std::vector<glz::raw_json> args;
 
   try {
 
@@ -3757,7 +5625,9 @@ Napi::Value Webview::Evaluate(const Napi::CallbackInfo& info) {
 
       , future_(std::move(fut))
 
-      , deferred_(std::move(deferred)) {}
+      , deferred_(std::move(deferred))
+
+      , started_(tracing::Now()) {}
 
 
 
@@ -3783,6 +5653,10 @@ Napi::Value Webview::Evaluate(const Napi::CallbackInfo& info) {
 
     void OnOK() override {
 
+      tracing::Span("evaluate", "evaluate", started_);
+
+      metrics::evaluate_latency.Record(tracing::Now() - started_);
+
       std::string json = glz::write_json(result_).value_or("null");
 
       try {
@@ -3807,6 +5681,10 @@ Napi::Value Webview::Evaluate(const Napi::CallbackInfo& info) {
 
     void OnError(const Napi::Error& err) override {
 
+      tracing::Span("evaluate", "evaluate", started_);
+
+      metrics::evaluate_latency.Record(tracing::Now() - started_);
+
       deferred_.Reject(err.Value());
 
     }
@@ -3821,6 +5699,8 @@ Napi::Value Webview::Evaluate(const Napi::CallbackInfo& info) {
 
     Napi::Promise::Deferred deferred_;
 
+    uint64_t started_;
+
   };
 
 
@@ -3923,18 +5803,91 @@ bool Webview::MessageCallback(saucer_handle* handle, const char* message) {
 
 
 
-  if (status != napi_ok) {
+  metrics::TrackCall(status == napi_ok);
+
+
+
+  if (status != napi_ok) {
+
+    delete payload;
+
+    return false;
+
+  }
+
+
+
+  return true;
+
+}
+
+
+
+// Binary values cross the bridge as { "$saucer_binary": "<base64>" } (lib/binary-bridge.js
+// is the page side); Buffer's base64 codec is SIMD-accelerated, unlike JSON number arrays
+constexpr std::string_view kBinaryTag = "$saucer_binary";
+
+static bool IsBinary(Napi::Value value) {
+  return value.IsTypedArray() || value.IsArrayBuffer() || value.IsDataView();
+}
+
+static std::string EncodeBinary(Napi::Env env, Napi::Value value) {
+  Napi::ArrayBuffer buffer;
+  size_t offset = 0;
+  size_t length = 0;
+
+  if (value.IsArrayBuffer()) {
+    buffer = value.As<Napi::ArrayBuffer>();
+    length = buffer.ByteLength();
+  } else if (value.IsTypedArray()) {
+    auto view = value.As<Napi::TypedArray>();
+    buffer = view.ArrayBuffer();
+    offset = view.ByteOffset();
+    length = view.ByteLength();
+  } else {
+    auto view = value.As<Napi::DataView>();
+    buffer = view.ArrayBuffer();
+    offset = view.ByteOffset();
+    length = view.ByteLength();
+  }
 
-    delete payload;
+  // Buffer.from(arrayBuffer, offset, length) shares the memory instead of copying it
+  Napi::Object buffer_class = env.Global().Get("Buffer").As<Napi::Object>();
+  Napi::Value bytes = buffer_class.Get("from").As<Napi::Function>().Call(buffer_class, {
+    buffer, Napi::Number::New(env, static_cast<double>(offset)), Napi::Number::New(env, static_cast<double>(length))
+  });
+  Napi::Value text = bytes.As<Napi::Object>().Get("toString").As<Napi::Function>().Call(bytes, { Napi::String::New(env, "base64") });
 
-    return false;
+  return text.As<Napi::String>().Utf8Value();
+}
 
+// JSON.stringify replacer that tags binary values at any depth. It reads the holder's own property:
+// by the time the replacer runs, Buffer's toJSON has already turned the value into { type, data }
+static Napi::Value ReplaceBinary(const Napi::CallbackInfo& info) {
+  Napi::Value value = info[1];
+  if (!value.IsObject()) {
+    return value;
   }
 
+  Napi::Value raw = info.This().As<Napi::Object>().Get(info[0]);
+  if (!IsBinary(raw)) {
+    return value;
+  }
 
+  Napi::Object tagged = Napi::Object::New(info.Env());
+  tagged.Set(std::string(kBinaryTag), EncodeBinary(info.Env(), raw));
+  return tagged;
+}
 
-  return true;
+// JSON.stringify(value) with binary values tagged; the replacer is created once per env
+static Napi::Value StringifyJson(Napi::Env env, Napi::Value value) {
+  AddonData& data = GetAddonData(env);
+  if (data.binary_replacer.IsEmpty()) {
+    data.binary_replacer = Napi::Persistent(Napi::Function::New(env, ReplaceBinary, "saucerBinaryReplacer"));
+  }
 
+  Napi::Object json = env.Global().Get("JSON").As<Napi::Object>();
+  return json.Get("stringify").As<Napi::Function>().Call(json, { value, data.binary_replacer.Value() });
 }
 
 
@@ -3974,7 +5927,7 @@ std::string Webview::StringifyForRPC(Napi::Env env, Napi::Value value) {
 
 
 
-  Napi::Value jsonVal = stringify.Call(json, { value });
+  Napi::Value jsonVal = StringifyJson(env, value);
 
   if (!jsonVal.IsString()) {
 
@@ -3988,6 +5941,32 @@ std::string Webview::StringifyForRPC(Napi::Env env, Napi::Value value) {
 
 
 
+// Result of a raw exposed handler: strings and Buffers are taken as pre-serialized JSON,
+// anything else goes through JSON.stringify
+std::string Webview::RawJsonForRPC(Napi::Env env, Napi::Value value) {
+  if (value.IsUndefined() || value.IsNull()) {
+    return "null";
+  }
+
+  if (value.IsString()) {
+    return value.As<Napi::String>().Utf8Value();
+  }
+
+  if (value.IsBuffer()) {
+    auto buffer = value.As<Napi::Buffer<char>>();
+    return std::string(buffer.Data(), buffer.Length());
+  }
+
+  Napi::Value text = StringifyJson(env, value);
+  if (!text.IsString()) {
+    throw Napi::Error::New(env, "Failed to stringify RPC value");
+  }
+
+  return text.As<Napi::String>().Utf8Value();
+}
+
+
+
 glz::json_t Webview::SerializeForRPC(Napi::Env env, Napi::Value value) {
 
   if (value.IsUndefined() || value.IsNull()) {
@@ -4018,17 +5997,42 @@ Napi::Value Webview::ParseJson(Napi::Env env, const std::string& jsonStr) {
 
   Napi::Function parse = json.Get("parse").As<Napi::Function>();
 
-  return parse.Call(json, { Napi::String::New(env, jsonStr) });
+  if (jsonStr.find(kBinaryTag) == std::string::npos) {
+
+    return parse.Call(json, { Napi::String::New(env, jsonStr) });
+
+  }
+
+  // Only payloads that mention the tag pay for a reviver
+  Napi::Function reviver = Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+    Napi::Value value = info[1];
+    if (!value.IsObject() || value.IsArray()) {
+      return value;
+    }
+
+    Napi::Object object = value.As<Napi::Object>();
+    Napi::Value encoded = object.Get(std::string(kBinaryTag));
+    if (!encoded.IsString() || object.GetPropertyNames().Length() != 1) {
+      return value;
+    }
+
+    Napi::Object buffer_class = info.Env().Global().Get("Buffer").As<Napi::Object>();
+    return buffer_class.Get("from").As<Napi::Function>().Call(buffer_class, { encoded, Napi::String::New(info.Env(), "base64") });
+  });
+
+  return parse.Call(json, { Napi::String::New(env, jsonStr), reviver });
 
 }
 
 
 
-std::vector<glz::json_t> Webview::CollectJsonArgs(const Napi::CallbackInfo& info, size_t startIndex) {
+// Arguments are substituted into the code as JSON text, so JSON.stringify's output is used as-is
+// instead of being parsed again. Text that carries binary tags is revived by the page runtime
+std::vector<glz::raw_json> Webview::CollectJsonArgs(const Napi::CallbackInfo& info, size_t startIndex) {
 
   Napi::Env env = info.Env();
 
-  std::vector<glz::json_t> args;
+  std::vector<glz::raw_json> args;
 
 
 
@@ -4040,15 +6044,9 @@ std::vector<glz::json_t> Webview::CollectJsonArgs(const Napi::CallbackInfo& info
 
 
 
-  Napi::Object json = env.Global().Get("JSON").As<Napi::Object>();
-
-  Napi::Function stringify = json.Get("stringify").As<Napi::Function>();
-
-
-
   for (size_t i = startIndex; i < info.Length(); ++i) {
 
-    Napi::Value strVal = stringify.Call(json, { info[i] });
+    Napi::Value strVal = StringifyJson(env, info[i]);
 
     if (!strVal.IsString()) {
 
@@ -4058,19 +6056,15 @@ std::vector<glz::json_t> Webview::CollectJsonArgs(const Napi::CallbackInfo& info
 
 
 
-    std::string jsonStr = strVal.As<Napi::String>().Utf8Value();
-
-    auto parsed = glz::read_json<glz::json_t>(jsonStr);
+    std::string text = strVal.As<Napi::String>().Utf8Value();
 
-    if (!parsed) {
+    if (text.find(kBinaryTag) != std::string::npos) {
 
-      throw Napi::Error::New(env, "Failed to parse serialized argument");
+      text = "window.__saucerBinary.revive(" + text + ")";
 
     }
 
-
-
-    args.push_back(std::move(parsed).value());
+    args.push_back(glz::raw_json{ std::move(text) });
 
   }
 
@@ -4082,227 +6076,155 @@ std::vector<glz::json_t> Webview::CollectJsonArgs(const Napi::CallbackInfo& info
 
 
 
-bool Webview::RegisterEvent(const std::string& event, Napi::Function cb, bool once) {
-
-  Napi::Env env = cb.Env();
-
+void* Webview::WindowEventForwarder(SAUCER_WINDOW_EVENT event) {
 
+  switch (event) {
 
-  SAUCER_WINDOW_EVENT window_event;
-
-  SAUCER_WEB_EVENT web_event;
+    case SAUCER_WINDOW_EVENT_DECORATED: return reinterpret_cast<void*>(&Webview::OnWindowDecorated);
 
-  bool is_window = MapWindowEventName(event, window_event);
+    case SAUCER_WINDOW_EVENT_MAXIMIZE: return reinterpret_cast<void*>(&Webview::OnWindowMaximize);
 
-  bool is_web = !is_window && MapWebEventName(event, web_event);
+    case SAUCER_WINDOW_EVENT_MINIMIZE: return reinterpret_cast<void*>(&Webview::OnWindowMinimize);
 
+    case SAUCER_WINDOW_EVENT_CLOSED: return reinterpret_cast<void*>(&Webview::OnWindowClosed);
 
+    case SAUCER_WINDOW_EVENT_RESIZE: return reinterpret_cast<void*>(&Webview::OnWindowResize);
 
-  if (!is_window && !is_web) {
+    case SAUCER_WINDOW_EVENT_FOCUS: return reinterpret_cast<void*>(&Webview::OnWindowFocus);
 
-    return false;
+    case SAUCER_WINDOW_EVENT_CLOSE: return reinterpret_cast<void*>(&Webview::OnWindowClose);
 
   }
 
+  return nullptr;
 
+}
 
-  auto tsfn = Napi::ThreadSafeFunction::New(
-
-    env,
-
-    cb,
-
-    "saucer.webview.event",
-
-    0,
-
-    1
-
-  );
-
-
-
-  auto data = std::make_shared<CallbackData>();
-
-  data->tsfn = tsfn;
-
-  data->once = once;
-
-  data->id = 0;
-
-  data->callback_ref = Napi::Persistent(cb);
-
-  data->callback_ref.SuppressDestruct();
-
-
-
-  bool registered = false;
-
-
-
-  if (is_window) {
-
-    switch (window_event) {
-
-      case SAUCER_WINDOW_EVENT_DECORATED:
-
-        if (once) { saucer_window_once(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowDecorated)); }
-
-        else { data->id = saucer_window_on(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowDecorated)); }
-
-        registered = true;
-
-        break;
-
-      case SAUCER_WINDOW_EVENT_MAXIMIZE:
 
-        if (once) { saucer_window_once(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowMaximize)); }
 
-        else { data->id = saucer_window_on(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowMaximize)); }
+void* Webview::WebEventForwarder(SAUCER_WEB_EVENT event) {
 
-        registered = true;
+  switch (event) {
 
-        break;
+    case SAUCER_WEB_EVENT_DOM_READY: return reinterpret_cast<void*>(&Webview::OnWebDomReady);
 
-      case SAUCER_WINDOW_EVENT_MINIMIZE:
+    case SAUCER_WEB_EVENT_NAVIGATED: return reinterpret_cast<void*>(&Webview::OnWebNavigated);
 
-        if (once) { saucer_window_once(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowMinimize)); }
+    case SAUCER_WEB_EVENT_NAVIGATE: return reinterpret_cast<void*>(&Webview::OnWebNavigate);
 
-        else { data->id = saucer_window_on(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowMinimize)); }
+    case SAUCER_WEB_EVENT_FAVICON: return reinterpret_cast<void*>(&Webview::OnWebFavicon);
 
-        registered = true;
+    case SAUCER_WEB_EVENT_TITLE: return reinterpret_cast<void*>(&Webview::OnWebTitle);
 
-        break;
+    case SAUCER_WEB_EVENT_LOAD: return reinterpret_cast<void*>(&Webview::OnWebLoad);
 
-      case SAUCER_WINDOW_EVENT_CLOSED:
+  }
 
-        if (once) { saucer_window_once(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowClosed)); }
+  return nullptr;
 
-        else { data->id = saucer_window_on(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowClosed)); }
+}
 
-        registered = true;
 
-        break;
 
-      case SAUCER_WINDOW_EVENT_RESIZE:
+bool Webview::RegisterEvent(const std::string& event, Napi::Function cb, bool once) {
 
-        if (once) { saucer_window_once(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowResize)); }
+  Napi::Env env = cb.Env();
 
-        else { data->id = saucer_window_on(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowResize)); }
 
-        registered = true;
 
-        break;
+  SAUCER_WINDOW_EVENT window_event;
 
-      case SAUCER_WINDOW_EVENT_FOCUS:
+  SAUCER_WEB_EVENT web_event;
 
-        if (once) { saucer_window_once(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowFocus)); }
+  bool is_window = MapWindowEventName(event, window_event);
 
-        else { data->id = saucer_window_on(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowFocus)); }
+  bool is_web = !is_window && MapWebEventName(event, web_event);
 
-        registered = true;
 
-        break;
 
-      case SAUCER_WINDOW_EVENT_CLOSE:
+  if (!is_window && !is_web) {
 
-        if (once) { saucer_window_once(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowClose)); }
+    return false;
 
-        else { data->id = saucer_window_on(webview_, window_event, reinterpret_cast<void*>(&Webview::OnWindowClose)); }
+  }
 
-        registered = true;
 
-        break;
 
-    }
+  void* forwarder = is_window ? WindowEventForwarder(window_event) : WebEventForwarder(web_event);
 
-  } else if (is_web) {
+  if (!forwarder) {
 
-    switch (web_event) {
+    return false;
 
-      case SAUCER_WEB_EVENT_DOM_READY:
+  }
 
-        if (once) { saucer_webview_once(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebDomReady)); }
 
-        else { data->id = saucer_webview_on(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebDomReady)); }
 
-        registered = true;
+  auto tsfn = Napi::ThreadSafeFunction::New(
 
-        break;
+    env,
 
-      case SAUCER_WEB_EVENT_NAVIGATED:
+    cb,
 
-        if (once) { saucer_webview_once(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebNavigated)); }
+    "saucer.webview.event",
 
-        else { data->id = saucer_webview_on(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebNavigated)); }
+    0,
 
-        registered = true;
+    1
 
-        break;
+  );
 
-      case SAUCER_WEB_EVENT_NAVIGATE:
 
-        if (once) { saucer_webview_once(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebNavigate)); }
 
-        else { data->id = saucer_webview_on(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebNavigate)); }
+  auto data = std::make_shared<CallbackData>();
 
-        registered = true;
+  data->tsfn = tsfn;
 
-        break;
+  data->once = once;
 
-      case SAUCER_WEB_EVENT_FAVICON:
+  data->callback_ref = Napi::Persistent(cb);
 
-        if (once) { saucer_webview_once(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebFavicon)); }
+  data->callback_ref.SuppressDestruct();
 
-        else { data->id = saucer_webview_on(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebFavicon)); }
 
-        registered = true;
 
-        break;
+  // One native subscription per event type; JS listeners (including once) share it
 
-      case SAUCER_WEB_EVENT_TITLE:
+  bool subscribe = false;
 
-        if (once) { saucer_webview_once(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebTitle)); }
+  {
 
-        else { data->id = saucer_webview_on(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebTitle)); }
+    std::scoped_lock lock(callback_mutex_);
 
-        registered = true;
+    data->id = ++next_listener_id_;
 
-        break;
+    event_callbacks_[event].push_back(data);
 
-      case SAUCER_WEB_EVENT_LOAD:
+    subscribe = !event_subscriptions_.contains(event);
 
-        if (once) { saucer_webview_once(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebLoad)); }
+  }
 
-        else { data->id = saucer_webview_on(webview_, web_event, reinterpret_cast<void*>(&Webview::OnWebLoad)); }
 
-        registered = true;
 
-        break;
+  if (subscribe) {
 
-    }
+    uint64_t id = is_window
 
-  }
+      ? saucer_window_on(webview_, window_event, forwarder)
 
+      : saucer_webview_on(webview_, web_event, forwarder);
 
 
-  if (registered) {
 
     std::scoped_lock lock(callback_mutex_);
 
-    event_callbacks_[event].push_back(data);
-
-  } else {
-
-    tsfn.Release();
-
-    data->callback_ref.Reset();
+    event_subscriptions_[event] = id;
 
   }
 
 
 
-  return registered;
+  return true;
 
 }
 
@@ -4310,86 +6232,93 @@ bool Webview::RegisterEvent(const std::string& event, Napi::Function cb, bool on
 
 void Webview::EmitEvent(const std::string& event, std::function<void(Napi::Env, Napi::Function)> invoker) {
 
-  std::vector<std::shared_ptr<CallbackData>> callbacks;
-
-  {
+  bool drained = false;
+  std::vector<std::shared_ptr<CallbackData>> callbacks = TakeCallbacks(event, &drained);
 
-    std::scoped_lock lock(callback_mutex_);
+  if (callbacks.empty()) {
 
-    auto it = event_callbacks_.find(event);
+    return;
 
-    if (it == event_callbacks_.end()) {
+  }
 
-      return;
 
-    }
 
-    callbacks = it->second;
+  // Every listener shares one copy of the invoker
+  struct SharedEvent {
+    std::string name;
+    std::function<void(Napi::Env, Napi::Function)> invoker;
+    uint64_t queued;
+  };
 
-  }
+  auto shared = std::make_shared<SharedEvent>(SharedEvent{ event, std::move(invoker), tracing::Timestamp() });
 
 
 
   for (auto& cb : callbacks) {
 
-    auto* fn = new std::function<void(Napi::Env, Napi::Function)>(invoker);
+    auto* fn = new std::shared_ptr<SharedEvent>(shared);
 
 
 
-    cb->tsfn.BlockingCall(fn,
+    napi_status status = cb->tsfn.BlockingCall(fn,
 
-      [](Napi::Env env, Napi::Function jsCallback, std::function<void(Napi::Env, Napi::Function)>* data) {
+      [](Napi::Env env, Napi::Function jsCallback, std::shared_ptr<SharedEvent>* data) {
+
+        tracing::Span("tsfn", (*data)->name, (*data)->queued);
 
         Napi::HandleScope scope(env);
 
-        (*data)(env, jsCallback);
+        (*data)->invoker(env, jsCallback);
 
         delete data;
 
       });
 
+    metrics::TrackCall(status == napi_ok);
 
+    if (status != napi_ok) {
 
-    if (cb->once) {
-
-      cb->tsfn.Release();
+      delete fn;
 
     }
 
-  }
 
 
+    if (cb->once) {
+
+      ReleaseOnceListener(event, cb, drained && cb == callbacks.back());
+
+    }
 
-  RemoveOnceCallbacks(event);
+  }
 
 }
 
 
 
 bool Webview::EvaluatePolicy(const std::string& event, std::function<Napi::Value(Napi::Env, Napi::Function)> invoker) {
-  std::vector<std::shared_ptr<CallbackData>> callbacks;
-  {
-    std::scoped_lock lock(callback_mutex_);
-    auto it = event_callbacks_.find(event);
-    if (it == event_callbacks_.end()) {
-      return true;
-    }
-    callbacks = it->second;
+  bool drained = false;
+  std::vector<std::shared_ptr<CallbackData>> callbacks = TakeCallbacks(event, &drained);
+  if (callbacks.empty()) {
+    return true;
   }
 
   struct PolicyPayload {
     std::shared_ptr<std::function<Napi::Value(Napi::Env, Napi::Function)>> invoker;
     std::shared_ptr<bool> allow;
+    std::string event;
+    uint64_t queued;
   };
 
   auto allow_state = std::make_shared<bool>(true);
   auto invoker_ptr = std::make_shared<std::function<Napi::Value(Napi::Env, Napi::Function)>>(std::move(invoker));
 
   for (auto& cb : callbacks) {
-    auto* payload = new PolicyPayload{ invoker_ptr, allow_state };
+    auto* payload = new PolicyPayload{ invoker_ptr, allow_state, event, tracing::Timestamp() };
 
-    cb->tsfn.BlockingCall(payload,
+    napi_status status = cb->tsfn.BlockingCall(payload,
       [](Napi::Env env, Napi::Function jsCallback, PolicyPayload* data) {
+        tracing::Span("tsfn", data->event, data->queued);
         Napi::HandleScope scope(env);
         try {
           Napi::Value result = (*(data->invoker))(env, jsCallback);
@@ -4414,196 +6343,223 @@ bool Webview::EvaluatePolicy(const std::string& event, std::function<Napi::Value
         delete data;
       });
 
+    metrics::TrackCall(status == napi_ok);
+    if (status != napi_ok) {
+      delete payload;
+    }
+
     if (cb->once) {
-      cb->tsfn.Release();
+      ReleaseOnceListener(event, cb, drained && cb == callbacks.back());
     }
   }
 
-  RemoveOnceCallbacks(event);
   return *allow_state;
 }
 
-void Webview::RemoveOnceCallbacks(const std::string& event) {
+std::vector<std::shared_ptr<Webview::CallbackData>> Webview::TakeCallbacks(const std::string& event, bool* drained) {
 
   std::scoped_lock lock(callback_mutex_);
 
   auto it = event_callbacks_.find(event);
 
-  if (it == event_callbacks_.end()) return;
-
+  if (it == event_callbacks_.end()) return {};
 
 
-  auto& vec = it->second;
 
-  vec.erase(std::remove_if(vec.begin(), vec.end(), [](std::shared_ptr<CallbackData>& cb) {
+  // Once-listeners leave the list before they are invoked so a re-entrant emit cannot fire them twice.
+  // *drained reports that only once-listeners were left, so the native subscription can go (see ReleaseOnceListener).
+  std::vector<std::shared_ptr<CallbackData>> snapshot = it->second;
 
-    if (cb->once) {
-
-      cb->callback_ref.Reset();
+  std::erase_if(it->second, [](const std::shared_ptr<CallbackData>& cb) { return cb->once; });
 
-      return true;
+  *drained = it->second.empty() && !snapshot.empty();
 
-    }
+  return snapshot;
 
-    return false;
+}
 
-  }), vec.end());
+// A fired once-listener gives up its TSFN. The last one also queues ReleaseSubscription behind its own call: the
+// emit may be running inside saucer's dispatch of this very event, where removing the native listener is not safe,
+// so the removal happens on the JS thread afterwards. ReleaseSubscription keeps it if a listener was added meanwhile.
+void Webview::ReleaseOnceListener(const std::string& event, const std::shared_ptr<CallbackData>& cb, bool last) {
+  if (last) {
+    saucer_handle* handle = webview_;
+    napi_status status = cb->tsfn.NonBlockingCall([handle, event](Napi::Env, Napi::Function) {
+      if (Webview* self = FromHandle(handle)) {
+        self->ReleaseSubscription(event);
+      }
+    });
+    metrics::TrackCall(status == napi_ok);
+  }
 
+  cb->tsfn.Release();
+  cb->callback_ref.Reset();
 }
 
 
 
-void Webview::RemoveCallbackById(const std::string& event, uint64_t id) {
+void Webview::ReleaseSubscription(const std::string& event) {
 
-  std::scoped_lock lock(callback_mutex_);
+  uint64_t id = 0;
 
-  auto it = event_callbacks_.find(event);
 
-  if (it == event_callbacks_.end()) return;
 
+  {
 
+    std::scoped_lock lock(callback_mutex_);
 
-  auto& vec = it->second;
+    auto listeners = event_callbacks_.find(event);
 
-  vec.erase(std::remove_if(vec.begin(), vec.end(), [id](std::shared_ptr<CallbackData>& cb) {
+    if (listeners != event_callbacks_.end() && !listeners->second.empty()) return;
 
-    if (cb->id == id) {
 
-      cb->tsfn.Release();
 
-      cb->callback_ref.Reset();
+    if (listeners != event_callbacks_.end()) {
 
-      return true;
+      event_callbacks_.erase(listeners);
 
     }
 
-    return false;
-
-  }), vec.end());
 
-}
 
+    auto it = event_subscriptions_.find(event);
 
+    if (it == event_subscriptions_.end()) return;
 
-void Webview::RemoveCallbackByFunction(const std::string& event, Napi::Function cb) {
 
-  std::vector<uint64_t> ids;
 
+    id = it->second;
 
+    event_subscriptions_.erase(it);
 
-  {
+  }
 
-    std::scoped_lock lock(callback_mutex_);
 
-    auto it = event_callbacks_.find(event);
 
-    if (it == event_callbacks_.end()) return;
+  SAUCER_WINDOW_EVENT window_event;
 
+  SAUCER_WEB_EVENT web_event;
 
 
-    auto& vec = it->second;
 
-    vec.erase(std::remove_if(vec.begin(), vec.end(), [&](std::shared_ptr<CallbackData>& data) {
+  if (MapWindowEventName(event, window_event)) {
 
-      bool match = data->callback_ref.Value().StrictEquals(cb);
+    saucer_window_remove(webview_, window_event, id);
 
-      if (match) {
+  } else if (MapWebEventName(event, web_event)) {
 
-        if (data->id != 0) {
+    saucer_webview_remove(webview_, web_event, id);
 
-          ids.push_back(data->id);
+  }
 
-        }
+}
 
-        data->tsfn.Release();
 
-        data->callback_ref.Reset();
 
-      }
+void Webview::RemoveCallbackById(const std::string& event, uint64_t id) {
 
-      return match;
+  {
 
-    }), vec.end());
+    std::scoped_lock lock(callback_mutex_);
 
-  }
+    auto it = event_callbacks_.find(event);
 
+    if (it == event_callbacks_.end()) return;
 
 
-  SAUCER_WINDOW_EVENT window_event;
 
-  SAUCER_WEB_EVENT web_event;
+    std::erase_if(it->second, [id](const std::shared_ptr<CallbackData>& cb) {
 
+      if (cb->id == id) {
 
+        cb->tsfn.Release();
 
-  if (MapWindowEventName(event, window_event)) {
+        cb->callback_ref.Reset();
 
-    for (auto id : ids) {
+        return true;
 
-      saucer_window_remove(webview_, window_event, id);
+      }
 
-    }
+      return false;
 
-  } else if (MapWebEventName(event, web_event)) {
+    });
 
-    for (auto id : ids) {
+  }
 
-      saucer_webview_remove(webview_, web_event, id);
 
-    }
 
-  }
+  ReleaseSubscription(event);
 
 }
 
 
 
-void Webview::RemoveAllCallbacks(const std::string& event) {
+void Webview::RemoveCallbackByFunction(const std::string& event, Napi::Function cb) {
 
-  SAUCER_WINDOW_EVENT window_event;
+  {
 
-  SAUCER_WEB_EVENT web_event;
+    std::scoped_lock lock(callback_mutex_);
 
+    auto it = event_callbacks_.find(event);
 
+    if (it == event_callbacks_.end()) return;
 
-  {
 
-    std::scoped_lock lock(callback_mutex_);
 
-    auto it = event_callbacks_.find(event);
+    std::erase_if(it->second, [&](const std::shared_ptr<CallbackData>& data) {
 
-    if (it == event_callbacks_.end()) {
+      bool match = data->callback_ref.Value().StrictEquals(cb);
 
-      return;
+      if (match) {
 
-    }
+        data->tsfn.Release();
+
+        data->callback_ref.Reset();
 
+      }
 
+      return match;
 
-    for (auto& cb : it->second) {
+    });
 
-      cb->tsfn.Release();
+  }
 
-      cb->callback_ref.Reset();
 
-    }
 
+  ReleaseSubscription(event);
 
+}
 
-    event_callbacks_.erase(it);
 
-  }
 
+void Webview::RemoveAllCallbacks(const std::string& event) {
 
+  {
 
-  if (MapWindowEventName(event, window_event)) {
+    std::scoped_lock lock(callback_mutex_);
+
+    auto it = event_callbacks_.find(event);
+
+    if (it != event_callbacks_.end()) {
+
+      for (auto& cb : it->second) {
 
-    saucer_window_clear(webview_, window_event);
+        cb->tsfn.Release();
+
+        cb->callback_ref.Reset();
+
+      }
+
+      it->second.clear();
+
+    }
+
+  }
 
-  } else if (MapWebEventName(event, web_event)) {
 
-    saucer_webview_clear(webview_, web_event);
 
-  }
+  // Removes only our own subscription, so natively registered listeners (startup timeline) survive
+  ReleaseSubscription(event);
 
 }
 
@@ -4921,6 +6877,23 @@ void Webview::OnWebLoad(saucer_handle* handle, SAUCER_STATE state) {
 
 }
 
+void Webview::OnStartupLoad(saucer_handle*, SAUCER_STATE state) {
+  StartupTimeline::Mark(state == SAUCER_STATE_STARTED ? "webview.load.started" : "webview.load.finished");
+}
+
+void Webview::OnStartupDomReady(saucer_handle*) {
+  StartupTimeline::Mark("webview.dom-ready");
+
+  // The timeline is complete and records nothing more: drop the load listeners it put on every webview
+  std::scoped_lock lock(instance_mutex_);
+  for (auto& [handle, webview] : instances_) {
+    if (webview->startup_load_listener_) {
+      saucer_webview_remove(handle, SAUCER_WEB_EVENT_LOAD, webview->startup_load_listener_);
+      webview->startup_load_listener_ = 0;
+    }
+  }
+}
+
 
 
 // ============================================================================
@@ -4930,8 +6903,6 @@ void Webview::OnWebLoad(saucer_handle* handle, SAUCER_STATE state) {
 class Stash : public Napi::ObjectWrap<Stash> {
 public:
   static Napi::Object Init(Napi::Env env, Napi::Object exports);
-  static Napi::FunctionReference constructor;
-
   Stash(const Napi::CallbackInfo& info);
   ~Stash();
 
@@ -4947,24 +6918,23 @@ private:
   // Static methods
   static Napi::Value From(const Napi::CallbackInfo& info);
   static Napi::Value View(const Napi::CallbackInfo& info);
+  static Napi::Value SharedStats(const Napi::CallbackInfo& info);
 
   // Instance methods
   Napi::Value GetSize(const Napi::CallbackInfo& info);
   Napi::Value GetData(const Napi::CallbackInfo& info);
 };
 
-Napi::FunctionReference Stash::constructor;
-
 Napi::Object Stash::Init(Napi::Env env, Napi::Object exports) {
   Napi::Function func = DefineClass(env, "Stash", {
     StaticMethod("from", &Stash::From),
     StaticMethod("view", &Stash::View),
+    StaticMethod("sharedStats", &Stash::SharedStats),
     InstanceAccessor("size", &Stash::GetSize, nullptr),
     InstanceMethod("getData", &Stash::GetData),
   });
 
-  constructor = Napi::Persistent(func);
-  constructor.SuppressDestruct();
+  GetAddonData(env).stash = Napi::Persistent(func);
 
   exports.Set("Stash", func);
   return exports;
@@ -4989,7 +6959,7 @@ Stash::~Stash() {
 
 Napi::Object Stash::Wrap(Napi::Env env, saucer_stash* stash) {
   Napi::External<saucer_stash> ext = Napi::External<saucer_stash>::New(env, stash);
-  return constructor.New({ ext });
+  return GetAddonData(env).stash.New({ ext });
 }
 
 Napi::Value Stash::From(const Napi::CallbackInfo& info) {
@@ -5000,8 +6970,9 @@ Napi::Value Stash::From(const Napi::CallbackInfo& info) {
     return env.Undefined();
   }
 
+  // Identical contents share one refcounted, process-wide copy
   Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
-  saucer_stash* stash = saucer_stash_from(buffer.Data(), buffer.Length());
+  saucer_stash* stash = saucer_stash_new_shared(buffer.Data(), buffer.Length());
 
   if (!stash) {
     return env.Null();
@@ -5028,6 +6999,19 @@ Napi::Value Stash::View(const Napi::CallbackInfo& info) {
   return Wrap(env, stash);
 }
 
+Napi::Value Stash::SharedStats(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t count = 0;
+  size_t bytes = 0;
+  saucer_stash_shared_stats(&count, &bytes);
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("entries", Napi::Number::New(env, static_cast<double>(count)));
+  result.Set("bytes", Napi::Number::New(env, static_cast<double>(bytes)));
+  return result;
+}
+
 Napi::Value Stash::GetSize(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -5062,8 +7046,6 @@ Napi::Value Stash::GetData(const Napi::CallbackInfo& info) {
 class Icon : public Napi::ObjectWrap<Icon> {
 public:
   static Napi::Object Init(Napi::Env env, Napi::Object exports);
-  static Napi::FunctionReference constructor;
-
   Icon(const Napi::CallbackInfo& info);
   ~Icon();
 
@@ -5085,8 +7067,6 @@ private:
   void Save(const Napi::CallbackInfo& info);
 };
 
-Napi::FunctionReference Icon::constructor;
-
 Napi::Object Icon::Init(Napi::Env env, Napi::Object exports) {
   Napi::Function func = DefineClass(env, "Icon", {
     StaticMethod("fromFile", &Icon::FromFile),
@@ -5096,8 +7076,7 @@ Napi::Object Icon::Init(Napi::Env env, Napi::Object exports) {
     InstanceMethod("save", &Icon::Save),
   });
 
-  constructor = Napi::Persistent(func);
-  constructor.SuppressDestruct();
+  GetAddonData(env).icon = Napi::Persistent(func);
 
   exports.Set("Icon", func);
   return exports;
@@ -5121,7 +7100,7 @@ Icon::~Icon() {
 
 Napi::Object Icon::Wrap(Napi::Env env, saucer_icon* icon) {
   Napi::External<saucer_icon> ext = Napi::External<saucer_icon>::New(env, icon);
-  return constructor.New({ ext });
+  return GetAddonData(env).icon.New({ ext });
 }
 
 Napi::Value Icon::FromFile(const Napi::CallbackInfo& info) {
@@ -5226,24 +7205,31 @@ void Icon::Save(const Napi::CallbackInfo& info) {
 class Desktop : public Napi::ObjectWrap<Desktop> {
 public:
   static Napi::Object Init(Napi::Env env, Napi::Object exports);
-  static Napi::FunctionReference constructor;
-
   Desktop(const Napi::CallbackInfo& info);
   ~Desktop();
 
 private:
   saucer_desktop* desktop_ = nullptr;
 
+  enum class PickerKind { File, Folder, Files, Folders };
+
+  static void ReadPickerOptions(const Napi::CallbackInfo& info, bool withFilters, std::optional<std::string>& initial,
+                                std::vector<std::string>& filters);
+  static saucer_picker_options* ParsePickerOptions(const Napi::CallbackInfo& info, bool withFilters);
+  Napi::Value PickAsync(const Napi::CallbackInfo& info, PickerKind kind);
+
   // Methods
   void Open(const Napi::CallbackInfo& info);
   Napi::Value PickFile(const Napi::CallbackInfo& info);
   Napi::Value PickFolder(const Napi::CallbackInfo& info);
   Napi::Value PickFiles(const Napi::CallbackInfo& info);
   Napi::Value PickFolders(const Napi::CallbackInfo& info);
+  Napi::Value PickFileAsync(const Napi::CallbackInfo& info);
+  Napi::Value PickFolderAsync(const Napi::CallbackInfo& info);
+  Napi::Value PickFilesAsync(const Napi::CallbackInfo& info);
+  Napi::Value PickFoldersAsync(const Napi::CallbackInfo& info);
 };
 
-Napi::FunctionReference Desktop::constructor;
-
 Napi::Object Desktop::Init(Napi::Env env, Napi::Object exports) {
   Napi::Function func = DefineClass(env, "Desktop", {
     InstanceMethod("open", &Desktop::Open),
@@ -5251,11 +7237,12 @@ Napi::Object Desktop::Init(Napi::Env env, Napi::Object exports) {
     InstanceMethod("pickFolder", &Desktop::PickFolder),
     InstanceMethod("pickFiles", &Desktop::PickFiles),
     InstanceMethod("pickFolders", &Desktop::PickFolders),
+    InstanceMethod("pickFileAsync", &Desktop::PickFileAsync),
+    InstanceMethod("pickFolderAsync", &Desktop::PickFolderAsync),
+    InstanceMethod("pickFilesAsync", &Desktop::PickFilesAsync),
+    InstanceMethod("pickFoldersAsync", &Desktop::PickFoldersAsync),
   });
 
-  constructor = Napi::Persistent(func);
-  constructor.SuppressDestruct();
-
   exports.Set("Desktop", func);
   return exports;
 }
@@ -5309,6 +7296,46 @@ Desktop::~Desktop() {
   }
 }
 
+void Desktop::ReadPickerOptions(const Napi::CallbackInfo& info, bool withFilters, std::optional<std::string>& initial,
+                                std::vector<std::string>& filters) {
+  if (info.Length() == 0 || !info[0].IsObject()) {
+    return;
+  }
+
+  Napi::Object opts = info[0].As<Napi::Object>();
+
+  if (opts.Has("initial") && opts.Get("initial").IsString()) {
+    initial = opts.Get("initial").As<Napi::String>().Utf8Value();
+  }
+
+  if (withFilters && opts.Has("filters") && opts.Get("filters").IsArray()) {
+    Napi::Array list = opts.Get("filters").As<Napi::Array>();
+    for (uint32_t i = 0; i < list.Length(); ++i) {
+      if (list.Get(i).IsString()) {
+        filters.push_back(list.Get(i).As<Napi::String>().Utf8Value());
+      }
+    }
+  }
+}
+
+saucer_picker_options* Desktop::ParsePickerOptions(const Napi::CallbackInfo& info, bool withFilters) {
+  saucer_picker_options* options = saucer_picker_options_new();
+
+  std::optional<std::string> initial;
+  std::vector<std::string> filters;
+  ReadPickerOptions(info, withFilters, initial, filters);
+
+  if (initial) {
+    saucer_picker_options_set_initial(options, initial->c_str());
+  }
+
+  for (const auto& filter : filters) {
+    saucer_picker_options_add_filter(options, filter.c_str());
+  }
+
+  return options;
+}
+
 void Desktop::Open(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -5334,27 +7361,7 @@ Napi::Value Desktop::PickFile(const Napi::CallbackInfo& info) {
     return env.Null();
   }
 
-  saucer_picker_options* options = saucer_picker_options_new();
-
-  // Parse options if provided
-  if (info.Length() > 0 && info[0].IsObject()) {
-    Napi::Object opts = info[0].As<Napi::Object>();
-
-    if (opts.Has("initial") && opts.Get("initial").IsString()) {
-      std::string initial = opts.Get("initial").As<Napi::String>().Utf8Value();
-      saucer_picker_options_set_initial(options, initial.c_str());
-    }
-
-    if (opts.Has("filters") && opts.Get("filters").IsArray()) {
-      Napi::Array filters = opts.Get("filters").As<Napi::Array>();
-      for (uint32_t i = 0; i < filters.Length(); ++i) {
-        if (filters.Get(i).IsString()) {
-          std::string filter = filters.Get(i).As<Napi::String>().Utf8Value();
-          saucer_picker_options_add_filter(options, filter.c_str());
-        }
-      }
-    }
-  }
+  saucer_picker_options* options = ParsePickerOptions(info, true);
 
   char* result = saucer_desktop_pick_file(desktop_, options);
   saucer_picker_options_free(options);
@@ -5376,16 +7383,7 @@ Napi::Value Desktop::PickFolder(const Napi::CallbackInfo& info) {
     return env.Null();
   }
 
-  saucer_picker_options* options = saucer_picker_options_new();
-
-  if (info.Length() > 0 && info[0].IsObject()) {
-    Napi::Object opts = info[0].As<Napi::Object>();
-
-    if (opts.Has("initial") && opts.Get("initial").IsString()) {
-      std::string initial = opts.Get("initial").As<Napi::String>().Utf8Value();
-      saucer_picker_options_set_initial(options, initial.c_str());
-    }
-  }
+  saucer_picker_options* options = ParsePickerOptions(info, false);
 
   char* result = saucer_desktop_pick_folder(desktop_, options);
   saucer_picker_options_free(options);
@@ -5407,26 +7405,7 @@ Napi::Value Desktop::PickFiles(const Napi::CallbackInfo& info) {
     return env.Null();
   }
 
-  saucer_picker_options* options = saucer_picker_options_new();
-
-  if (info.Length() > 0 && info[0].IsObject()) {
-    Napi::Object opts = info[0].As<Napi::Object>();
-
-    if (opts.Has("initial") && opts.Get("initial").IsString()) {
-      std::string initial = opts.Get("initial").As<Napi::String>().Utf8Value();
-      saucer_picker_options_set_initial(options, initial.c_str());
-    }
-
-    if (opts.Has("filters") && opts.Get("filters").IsArray()) {
-      Napi::Array filters = opts.Get("filters").As<Napi::Array>();
-      for (uint32_t i = 0; i < filters.Length(); ++i) {
-        if (filters.Get(i).IsString()) {
-          std::string filter = filters.Get(i).As<Napi::String>().Utf8Value();
-          saucer_picker_options_add_filter(options, filter.c_str());
-        }
-      }
-    }
-  }
+  saucer_picker_options* options = ParsePickerOptions(info, true);
 
   char** results = saucer_desktop_pick_files(desktop_, options);
   saucer_picker_options_free(options);
@@ -5454,16 +7433,7 @@ Napi::Value Desktop::PickFolders(const Napi::CallbackInfo& info) {
     return env.Null();
   }
 
-  saucer_picker_options* options = saucer_picker_options_new();
-
-  if (info.Length() > 0 && info[0].IsObject()) {
-    Napi::Object opts = info[0].As<Napi::Object>();
-
-    if (opts.Has("initial") && opts.Get("initial").IsString()) {
-      std::string initial = opts.Get("initial").As<Napi::String>().Utf8Value();
-      saucer_picker_options_set_initial(options, initial.c_str());
-    }
-  }
+  saucer_picker_options* options = ParsePickerOptions(info, false);
 
   char** results = saucer_desktop_pick_folders(desktop_, options);
   saucer_picker_options_free(options);
@@ -5483,6 +7453,105 @@ Napi::Value Desktop::PickFolders(const Napi::CallbackInfo& info) {
   return arr;
 }
 
+// Promise-returning pickers. saucer's picks block until the dialog closes, so these use the platform's
+// non-blocking chooser: the dialog is shown and the call returns { promise, cancel } at once. The chooser reports
+// back on the UI thread and the promise settles through a TSFN, so the Node event loop keeps turning meanwhile.
+
+Napi::Value Desktop::PickAsync(const Napi::CallbackInfo& info, PickerKind kind) {
+  Napi::Env env = info.Env();
+
+  struct PickState {
+    Napi::Promise::Deferred deferred;
+    Napi::ThreadSafeFunction tsfn;
+    saucer_pick_request_ext* request = nullptr;
+  };
+
+  auto state = std::make_shared<PickState>(PickState{Napi::Promise::Deferred::New(env)});
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("promise", state->deferred.Promise());
+  result.Set("cancel", Napi::Function::New(env, [state](const Napi::CallbackInfo&) {
+    // Both this and the chooser's callback run on the UI thread, so the request is either pending or cleared
+    if (state->request) {
+      ::saucer_desktop_pick_cancel_ext(state->request);
+    }
+  }));
+
+  if (!desktop_) {
+    state->deferred.Reject(Napi::Error::New(env, "Desktop not initialized").Value());
+    return result;
+  }
+
+  std::optional<std::string> initial;
+  std::vector<std::string> filters;
+  ReadPickerOptions(info, kind == PickerKind::File || kind == PickerKind::Files, initial, filters);
+
+  saucer_picker_kind_ext native_kind = saucer_picker_kind_ext::file;
+  switch (kind) {
+    case PickerKind::File: native_kind = saucer_picker_kind_ext::file; break;
+    case PickerKind::Folder: native_kind = saucer_picker_kind_ext::folder; break;
+    case PickerKind::Files: native_kind = saucer_picker_kind_ext::files; break;
+    case PickerKind::Folders: native_kind = saucer_picker_kind_ext::folders; break;
+  }
+
+  bool multiple = kind == PickerKind::Files || kind == PickerKind::Folders;
+
+  state->tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+                                              "saucer.desktop.pickAsync", 0, 1);
+
+  using Selection = std::optional<std::vector<std::string>>;
+
+  state->request = ::saucer_desktop_pick_async_ext(native_kind, initial, filters, [state, multiple](Selection selection) {
+    state->request = nullptr;
+
+    auto* payload = new Selection(std::move(selection));
+    auto status = state->tsfn.NonBlockingCall(payload, [state, multiple](Napi::Env env, Napi::Function, Selection* payload) {
+      std::unique_ptr<Selection> selection{payload};
+
+      if (!*selection || (*selection)->empty()) {
+        state->deferred.Resolve(env.Null());
+      } else if (!multiple) {
+        state->deferred.Resolve(Napi::String::New(env, (*selection)->front()));
+      } else {
+        Napi::Array paths = Napi::Array::New(env, (*selection)->size());
+        for (uint32_t i = 0; i < (*selection)->size(); ++i) {
+          paths.Set(i, Napi::String::New(env, (**selection)[i]));
+        }
+        state->deferred.Resolve(paths);
+      }
+    });
+
+    if (status != napi_ok) {
+      delete payload;
+    }
+
+    state->tsfn.Release();
+  });
+
+  if (!state->request) {
+    state->tsfn.Release();
+    state->deferred.Reject(Napi::Error::New(env, "Non-blocking pickers are not supported on this platform yet").Value());
+  }
+
+  return result;
+}
+
+Napi::Value Desktop::PickFileAsync(const Napi::CallbackInfo& info) {
+  return PickAsync(info, PickerKind::File);
+}
+
+Napi::Value Desktop::PickFolderAsync(const Napi::CallbackInfo& info) {
+  return PickAsync(info, PickerKind::Folder);
+}
+
+Napi::Value Desktop::PickFilesAsync(const Napi::CallbackInfo& info) {
+  return PickAsync(info, PickerKind::Files);
+}
+
+Napi::Value Desktop::PickFoldersAsync(const Napi::CallbackInfo& info) {
+  return PickAsync(info, PickerKind::Folders);
+}
+
 // ============================================================================
 // PDF Class - Export webview content to PDF
 // ============================================================================
@@ -5490,27 +7559,165 @@ Napi::Value Desktop::PickFolders(const Napi::CallbackInfo& info) {
 class PDF : public Napi::ObjectWrap<PDF> {
 public:
   static Napi::Object Init(Napi::Env env, Napi::Object exports);
-  static Napi::FunctionReference constructor;
-
   PDF(const Napi::CallbackInfo& info);
   ~PDF();
 
 private:
+  friend struct PdfExportQueue;
+
   saucer_pdf* pdf_ = nullptr;
 
+  // The Webview this PDF renders from; jobs take their own reference while they run
+  Webview* webview_ = nullptr;
+  Napi::ObjectReference webview_ref_;
+
+  struct ExportOptions {
+    std::string file;
+    bool landscape = false;
+    std::optional<double> width;
+    std::optional<double> height;
+  };
+
+  struct ExportJob {
+    saucer_pdf* pdf = nullptr;
+    ExportOptions options;
+    // Where a file export ends up; it is rendered to options.file next to it and renamed once complete
+    std::string target;
+    bool to_buffer = false;
+    std::vector<uint8_t> data;
+    // The PDF (owns pdf) and the Webview it prints; both stay alive until the job settles
+    Napi::ObjectReference owner;
+    Napi::ObjectReference view;
+    Webview* webview = nullptr;
+    Napi::Promise::Deferred deferred;
+
+    explicit ExportJob(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+  };
+
+  class RenderWorker;
+  class ReadWorker;
+
+  static std::atomic<uint64_t> export_counter_;
+
+  static ExportOptions ParseOptions(const Napi::CallbackInfo& info);
+  static void RenderJob(const ExportJob& job);
+  static PdfExportQueue& ExportQueue(Napi::Env env);
+  static void PumpQueue(Napi::Env env);
+  static void FinishRender(ExportJob& job);
+
   void Save(const Napi::CallbackInfo& info);
+  Napi::Value SaveAsync(const Napi::CallbackInfo& info);
+};
+
+// Exports are rendered one at a time (the webview's print operation runs on the UI thread); reading a finished
+// buffer back overlaps with rendering the next job.
+struct PdfExportQueue {
+  std::deque<std::shared_ptr<PDF::ExportJob>> jobs;
+  bool busy = false;
+};
+
+std::atomic<uint64_t> PDF::export_counter_{0};
+
+class PDF::RenderWorker : public Napi::AsyncWorker {
+public:
+  RenderWorker(Napi::Env env, std::shared_ptr<ExportJob> job) : Napi::AsyncWorker(env), job_(std::move(job)) {}
+
+  void Execute() override {
+    try {
+      PDF::RenderJob(*job_);
+    } catch (const std::exception& err) {
+      SetError(err.what());
+      return;
+    }
+
+    // Every job renders to a fresh path, so an existing (or stale) file cannot pass for this export's output
+    std::error_code ec;
+    auto size = std::filesystem::file_size(job_->options.file, ec);
+    if (ec || size == 0) {
+      SetError("PDF export produced no output");
+      return;
+    }
+
+    if (!job_->to_buffer) {
+      std::filesystem::rename(job_->options.file, job_->target, ec);
+      if (ec) {
+        SetError("Failed to move exported PDF into place: " + ec.message());
+      }
+    }
+  }
+
+  void OnOK() override {
+    PDF::FinishRender(*job_);
+    PDF::PumpQueue(Env());
+
+    if (job_->to_buffer) {
+      (new ReadWorker(Env(), job_))->Queue();
+      return;
+    }
+
+    job_->deferred.Resolve(Napi::String::New(Env(), job_->target));
+    job_->owner.Reset();
+  }
+
+  void OnError(const Napi::Error& err) override {
+    PDF::FinishRender(*job_);
+    PDF::PumpQueue(Env());
+
+    std::error_code ec;
+    std::filesystem::remove(job_->options.file, ec);
+
+    job_->deferred.Reject(err.Value());
+    job_->owner.Reset();
+  }
+
+private:
+  std::shared_ptr<ExportJob> job_;
 };
 
-Napi::FunctionReference PDF::constructor;
+class PDF::ReadWorker : public Napi::AsyncWorker {
+public:
+  ReadWorker(Napi::Env env, std::shared_ptr<ExportJob> job) : Napi::AsyncWorker(env), job_(std::move(job)) {}
+
+  void Execute() override {
+    std::ifstream stream(job_->options.file, std::ios::binary | std::ios::ate);
+    if (!stream) {
+      SetError("Failed to read exported PDF");
+    } else {
+      job_->data.resize(static_cast<size_t>(stream.tellg()));
+      stream.seekg(0);
+      stream.read(reinterpret_cast<char*>(job_->data.data()), static_cast<std::streamsize>(job_->data.size()));
+      if (!stream) {
+        SetError("Failed to read exported PDF");
+      }
+    }
+
+    stream.close();
+
+    std::error_code ec;
+    std::filesystem::remove(job_->options.file, ec);
+  }
+
+  void OnOK() override {
+    job_->deferred.Resolve(Napi::Buffer<uint8_t>::Copy(Env(), job_->data.data(), job_->data.size()));
+    job_->data.clear();
+    job_->owner.Reset();
+  }
+
+  void OnError(const Napi::Error& err) override {
+    job_->deferred.Reject(err.Value());
+    job_->owner.Reset();
+  }
+
+private:
+  std::shared_ptr<ExportJob> job_;
+};
 
 Napi::Object PDF::Init(Napi::Env env, Napi::Object exports) {
   Napi::Function func = DefineClass(env, "PDF", {
     InstanceMethod("save", &PDF::Save),
+    InstanceMethod("saveAsync", &PDF::SaveAsync),
   });
 
-  constructor = Napi::Persistent(func);
-  constructor.SuppressDestruct();
-
   exports.Set("PDF", func);
   return exports;
 }
@@ -5541,6 +7748,8 @@ PDF::PDF(const Napi::CallbackInfo& info) : Napi::ObjectWrap<PDF>(info) {
     Webview* webview = Napi::ObjectWrap<Webview>::Unwrap(nativeObj);
     if (webview) {
       handle = webview->GetWebview();
+      webview_ = webview;
+      webview_ref_ = Napi::Persistent(nativeObj);
     }
   }
 
@@ -5559,48 +7768,156 @@ PDF::~PDF() {
   }
 }
 
-void PDF::Save(const Napi::CallbackInfo& info) {
-  Napi::Env env = info.Env();
-
-  if (!pdf_) {
-    Napi::Error::New(env, "PDF not initialized").ThrowAsJavaScriptException();
-    return;
-  }
-
-  saucer_print_settings* settings = saucer_print_settings_new();
+PDF::ExportOptions PDF::ParseOptions(const Napi::CallbackInfo& info) {
+  ExportOptions options;
 
   if (info.Length() > 0 && info[0].IsObject()) {
     Napi::Object opts = info[0].As<Napi::Object>();
 
     if (opts.Has("file") && opts.Get("file").IsString()) {
-      std::string file = opts.Get("file").As<Napi::String>().Utf8Value();
-      saucer_print_settings_set_file(settings, file.c_str());
+      options.file = opts.Get("file").As<Napi::String>().Utf8Value();
     }
 
     if (opts.Has("orientation") && opts.Get("orientation").IsString()) {
-      std::string orientation = opts.Get("orientation").As<Napi::String>().Utf8Value();
-      if (orientation == "landscape") {
-        saucer_print_settings_set_orientation(settings, SAUCER_LAYOUT_LANDSCAPE);
-      } else {
-        saucer_print_settings_set_orientation(settings, SAUCER_LAYOUT_PORTRAIT);
-      }
+      options.landscape = opts.Get("orientation").As<Napi::String>().Utf8Value() == "landscape";
     }
 
     if (opts.Has("width") && opts.Get("width").IsNumber()) {
-      double width = opts.Get("width").As<Napi::Number>().DoubleValue();
-      saucer_print_settings_set_width(settings, width);
+      options.width = opts.Get("width").As<Napi::Number>().DoubleValue();
     }
 
     if (opts.Has("height") && opts.Get("height").IsNumber()) {
-      double height = opts.Get("height").As<Napi::Number>().DoubleValue();
-      saucer_print_settings_set_height(settings, height);
+      options.height = opts.Get("height").As<Napi::Number>().DoubleValue();
     }
   }
 
+  return options;
+}
+
+void PDF::RenderJob(const ExportJob& job) {
+  saucer_print_settings* settings = saucer_print_settings_new();
+
+  saucer_print_settings_set_file(settings, job.options.file.c_str());
+  saucer_print_settings_set_orientation(settings, job.options.landscape ? SAUCER_LAYOUT_LANDSCAPE : SAUCER_LAYOUT_PORTRAIT);
+
+  if (job.options.width) {
+    saucer_print_settings_set_width(settings, *job.options.width);
+  }
+
+  if (job.options.height) {
+    saucer_print_settings_set_height(settings, *job.options.height);
+  }
+
+  // Called from a worker thread: saucer marshals the print operation onto the UI thread. That is the JS thread, so
+  // JS does not run while the page prints; only the wait for the result is off-thread.
+  saucer_pdf_save(job.pdf, settings);
+  saucer_print_settings_free(settings);
+}
+
+PdfExportQueue& PDF::ExportQueue(Napi::Env env) {
+  AddonData& data = GetAddonData(env);
+  if (!data.pdf_exports) {
+    data.pdf_exports = std::make_shared<PdfExportQueue>();
+  }
+  return *data.pdf_exports;
+}
+
+void PDF::PumpQueue(Napi::Env env) {
+  PdfExportQueue& queue = ExportQueue(env);
+  if (queue.busy || queue.jobs.empty()) {
+    return;
+  }
+
+  auto job = queue.jobs.front();
+  queue.jobs.pop_front();
+
+  queue.busy = true;
+  (new RenderWorker(env, std::move(job)))->Queue();
+}
+
+// Rendering is over (reading a buffer back does not touch the webview): free the queue and let the view close
+void PDF::FinishRender(ExportJob& job) {
+  ExportQueue(job.deferred.Env()).busy = false;
+
+  if (job.webview) {
+    job.webview->EndExport();
+    job.webview = nullptr;
+  }
+  job.view.Reset();
+}
+
+void PDF::Save(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (!pdf_) {
+    Napi::Error::New(env, "PDF not initialized").ThrowAsJavaScriptException();
+    return;
+  }
+
+  saucer_print_settings* settings = saucer_print_settings_new();
+  ExportOptions options = ParseOptions(info);
+
+  if (!options.file.empty()) {
+    saucer_print_settings_set_file(settings, options.file.c_str());
+  }
+
+  saucer_print_settings_set_orientation(settings, options.landscape ? SAUCER_LAYOUT_LANDSCAPE : SAUCER_LAYOUT_PORTRAIT);
+
+  if (options.width) {
+    saucer_print_settings_set_width(settings, *options.width);
+  }
+
+  if (options.height) {
+    saucer_print_settings_set_height(settings, *options.height);
+  }
+
   saucer_pdf_save(pdf_, settings);
   saucer_print_settings_free(settings);
 }
 
+Napi::Value PDF::SaveAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (!pdf_) {
+    Napi::Error::New(env, "PDF not initialized").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+
+  auto job = std::make_shared<ExportJob>(env);
+  job->pdf = pdf_;
+  job->options = ParseOptions(info);
+  job->owner = Napi::Persistent(Value());
+  job->view = Napi::Persistent(webview_ref_.Value());
+  job->webview = webview_;
+
+  auto suffix = std::to_string(reinterpret_cast<uintptr_t>(this)) + "-" + std::to_string(++export_counter_);
+
+  // Without a target file the PDF is rendered to a private temporary file and handed back as a Buffer
+  if (!job->options.file.empty()) {
+    job->target = job->options.file;
+    job->options.file = job->target + ".saucer-" + suffix + ".tmp";
+  } else {
+    std::error_code ec;
+    auto dir = std::filesystem::temp_directory_path(ec);
+    if (ec) {
+      Napi::Error::New(env, "No temporary directory available for in-memory PDF export").ThrowAsJavaScriptException();
+      return env.Undefined();
+    }
+
+    auto name = "saucer-pdf-" + suffix + ".pdf";
+    job->options.file = (dir / name).string();
+    job->to_buffer = true;
+  }
+
+  Napi::Promise promise = job->deferred.Promise();
+
+  job->webview->BeginExport();
+  ExportQueue(env).jobs.push_back(std::move(job));
+  PumpQueue(env);
+
+  return promise;
+}
+
 // ============================================================================
 
 // Module initialization
@@ -5611,8 +7928,17 @@ void PDF::Save(const Napi::CallbackInfo& info) {
 
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
 
+  StartupTimeline::Mark("addon.load");
+
+  env.SetInstanceData(new AddonData());
+
   Application::Init(env, exports);
 
+  Napi::Object stallWatchdog = Napi::Object::New(env);
+  stallWatchdog.Set("sample", Napi::Function::New(env, RegisterStallSampler));
+  stallWatchdog.Set("active", Napi::Function::New(env, IsStallActive));
+  exports.Set("watchdog", stallWatchdog);
+
   Webview::Init(env, exports);
 
   Stash::Init(env, exports);
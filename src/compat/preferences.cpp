@@ -46,4 +46,19 @@ extern "C"
     {
         handle->value().user_agent = user_agent;
     }
+
+    void saucer_preferences_set_shared_context(saucer_preferences *handle, const char *group)
+    {
+        handle->value().shared_context = group;
+    }
+
+    void saucer_preferences_set_cache_model(saucer_preferences *handle, SAUCER_CACHE_MODEL model)
+    {
+        handle->value().cache_model = model;
+    }
+
+    void saucer_preferences_set_process_limit(saucer_preferences *handle, size_t limit)
+    {
+        handle->value().process_limit = limit;
+    }
 }
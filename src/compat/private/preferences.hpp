@@ -1,10 +1,12 @@
 #pragma once
 
+#include "preferences.h"
 #include "utils/handle.hpp"
 
 #include <saucer/app.hpp>
 
 #include <set>
+#include <cstddef>
 #include <string>
 #include <memory>
 #include <optional>
@@ -24,6 +26,11 @@ struct saucer_preferences_data
 
   public:
     std::set<std::string> browser_flags;
+
+  public:
+    std::optional<std::string> shared_context;
+    SAUCER_CACHE_MODEL cache_model{SAUCER_CACHE_MODEL_DEFAULT};
+    std::optional<std::size_t> process_limit;
 };
 
 struct saucer_preferences : bindings::handle<saucer_preferences, saucer_preferences_data>
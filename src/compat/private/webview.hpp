@@ -97,7 +97,8 @@ struct saucer_handle
     auto evaluate(const std::string &code, Ts &&...params)
     {
         auto formatted = format_runtime(code, std::forward<Ts>(params)...);
-        auto future = view.template evaluate<R>("eval({})", formatted);
+        // Binary results leave the page tagged (lib/binary-bridge.js), everything else as-is
+        auto future = view.template evaluate<R>("(window.__saucerBinary ? window.__saucerBinary.tag : (value) => value)(eval({}))", formatted);
 
         return std::async(std::launch::async, [future = std::move(future)]() mutable -> R {
             auto result = future.get();
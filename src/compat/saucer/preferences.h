@@ -11,6 +11,14 @@ extern "C"
 
 #include <stddef.h>
 
+    enum SAUCER_CACHE_MODEL
+    {
+        SAUCER_CACHE_MODEL_DEFAULT,
+        SAUCER_CACHE_MODEL_DOCUMENT_VIEWER,
+        SAUCER_CACHE_MODEL_DOCUMENT_BROWSER,
+        SAUCER_CACHE_MODEL_WEB_BROWSER,
+    };
+
     struct saucer_preferences;
 
     SAUCER_EXPORT saucer_preferences *saucer_preferences_new(saucer_application *app);
@@ -23,6 +31,10 @@ extern "C"
     SAUCER_EXPORT void saucer_preferences_add_browser_flag(saucer_preferences *, const char *flag);
     SAUCER_EXPORT void saucer_preferences_set_user_agent(saucer_preferences *, const char *user_agent);
 
+    SAUCER_EXPORT void saucer_preferences_set_shared_context(saucer_preferences *, const char *group);
+    SAUCER_EXPORT void saucer_preferences_set_cache_model(saucer_preferences *, SAUCER_CACHE_MODEL model);
+    SAUCER_EXPORT void saucer_preferences_set_process_limit(saucer_preferences *, size_t limit);
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,6 +39,13 @@ extern "C"
     SAUCER_EXPORT saucer_stash *saucer_stash_new_view_str(const char *str);
     SAUCER_EXPORT saucer_stash *saucer_stash_new_empty();
 
+    /**
+     * @note Content-addressed: stashes created from identical bytes share one process-wide allocation, which is
+     * released once the last stash (or embedded file) referencing it goes away.
+     */
+    SAUCER_EXPORT saucer_stash *saucer_stash_new_shared(const uint8_t *data, size_t size);
+    SAUCER_EXPORT void saucer_stash_shared_stats(size_t *count, size_t *bytes);
+
 #ifdef __cplusplus
 }
 #endif
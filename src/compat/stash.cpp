@@ -1,9 +1,134 @@
 #include "stash.h"
 #include "stash.hpp"
 
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <span>
+#include <unordered_map>
 #include <vector>
 
+namespace
+{
+    using shared_bytes = std::shared_ptr<const std::vector<uint8_t>>;
+
+    constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+
+    std::uint64_t read64(const uint8_t *data)
+    {
+        std::uint64_t rtn{};
+        std::memcpy(&rtn, data, sizeof(rtn));
+        return rtn;
+    }
+
+    // xxh64-style hash: four independent lanes over 32-byte stripes, scalar tail, avalanche at the end.
+    std::uint64_t hash_bytes(const uint8_t *data, size_t size)
+    {
+        const auto *end = data + size;
+        std::uint64_t h = prime3 ^ (size * prime1);
+
+        if (size >= 32)
+        {
+            std::uint64_t lanes[4] = {prime1 + prime2, prime2, 0, 0 - prime1};
+
+            for (; end - data >= 32; data += 32)
+            {
+                for (auto i = 0u; i < 4; ++i)
+                {
+                    lanes[i] = std::rotl(lanes[i] + read64(data + (i * 8)) * prime2, 31) * prime1;
+                }
+            }
+
+            h ^= std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+        }
+
+        for (; end - data >= 8; data += 8)
+        {
+            h = std::rotl(h ^ (read64(data) * prime2), 27) * prime1 + prime3;
+        }
+
+        for (; data < end; ++data)
+        {
+            h = std::rotl(h ^ (*data * prime3), 11) * prime1;
+        }
+
+        h ^= h >> 33;
+        h *= prime2;
+        h ^= h >> 29;
+        h *= prime3;
+        h ^= h >> 32;
+
+        return h;
+    }
+
+    struct shared_store
+    {
+        std::mutex mutex;
+        std::unordered_multimap<std::uint64_t, std::weak_ptr<const std::vector<uint8_t>>> entries;
+
+      public:
+        shared_bytes acquire(const uint8_t *data, size_t size)
+        {
+            const auto key = hash_bytes(data, size);
+            std::lock_guard lock{mutex};
+
+            auto [begin, end] = entries.equal_range(key);
+
+            for (auto it = begin; it != end;)
+            {
+                auto bytes = it->second.lock();
+
+                if (!bytes)
+                {
+                    it = entries.erase(it);
+                    continue;
+                }
+
+                if (bytes->size() == size && std::memcmp(bytes->data(), data, size) == 0)
+                {
+                    return bytes;
+                }
+
+                ++it;
+            }
+
+            auto rtn = std::make_shared<const std::vector<uint8_t>>(data, data + size);
+            entries.emplace(key, rtn);
+
+            return rtn;
+        }
+
+        template <typename Callback>
+        void visit(Callback &&callback)
+        {
+            std::lock_guard lock{mutex};
+
+            for (auto it = entries.begin(); it != entries.end();)
+            {
+                auto bytes = it->second.lock();
+
+                if (!bytes)
+                {
+                    it = entries.erase(it);
+                    continue;
+                }
+
+                callback(*bytes);
+                ++it;
+            }
+        }
+    };
+
+    shared_store &store()
+    {
+        static shared_store instance;
+        return instance;
+    }
+} // namespace
+
 extern "C"
 {
     void saucer_stash_free(saucer_stash *handle)
@@ -100,4 +225,45 @@ extern "C"
     {
         return saucer_stash::from(saucer::stash::empty());
     }
+
+    saucer_stash *saucer_stash_new_shared(const uint8_t *data, size_t size)
+    {
+        if (!data || size == 0)
+        {
+            return saucer_stash::from(saucer::stash::empty());
+        }
+
+        // The lazy callback owns the shared bytes, so every copy of the resulting stash (including the ones handed
+        // to embedded files) keeps the allocation alive while only viewing it.
+        auto bytes = store().acquire(data, size);
+
+        return saucer_stash::from(saucer::stash::lazy(
+            [bytes = std::move(bytes)]()
+            {
+                return saucer::stash::view(std::span<const uint8_t>{bytes->data(), bytes->size()});
+            }));
+    }
+
+    void saucer_stash_shared_stats(size_t *count, size_t *bytes)
+    {
+        size_t total_count{0};
+        size_t total_bytes{0};
+
+        store().visit(
+            [&](const auto &entry)
+            {
+                total_count++;
+                total_bytes += entry.size();
+            });
+
+        if (count)
+        {
+            *count = total_count;
+        }
+
+        if (bytes)
+        {
+            *bytes = total_bytes;
+        }
+    }
 }
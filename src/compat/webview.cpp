@@ -14,6 +14,9 @@
 #include <filesystem>
 #include <optional>
 #include <utility>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 struct saucer_embedded_file : bindings::handle<saucer_embedded_file, saucer::embedded_file>
 {
@@ -39,6 +42,36 @@ namespace
     {
         return state == saucer::state::started ? SAUCER_STATE_STARTED : SAUCER_STATE_FINISHED;
     }
+
+    struct shared_context
+    {
+        bool persistent_cookies;
+        std::optional<std::filesystem::path> storage_path;
+    };
+
+    // Webviews in the same group are pinned to the storage settings of the group's first member. WebView2 keys its
+    // user data folder, and with it the browser process, on these. On WebKitGTK the group's WebKitWebContext is
+    // injected at construction instead (saucer_webview_begin_context_ext), this only keeps the options consistent.
+    void join_shared_context(const std::string &group, saucer::smartview::options &options)
+    {
+        static std::mutex mutex;
+        static std::unordered_map<std::string, shared_context> groups;
+
+        std::lock_guard lock{mutex};
+
+        auto [it, inserted] = groups.try_emplace(group, shared_context{
+                                                            .persistent_cookies = options.persistent_cookies,
+                                                            .storage_path = options.storage_path,
+                                                        });
+
+        if (inserted)
+        {
+            return;
+        }
+
+        options.persistent_cookies = it->second.persistent_cookies;
+        options.storage_path = it->second.storage_path;
+    }
 }
 
 extern "C"
@@ -124,6 +157,19 @@ extern "C"
         options.user_agent = prefs->value().user_agent;
         options.browser_flags = prefs->value().browser_flags;
 
+        if (prefs->value().shared_context)
+        {
+            join_shared_context(prefs->value().shared_context.value(), options);
+        }
+
+#ifdef _WIN32
+        // WebView2 has no per-context process API; the limit is passed to the browser process instead
+        if (prefs->value().process_limit)
+        {
+            options.browser_flags.emplace("--renderer-process-limit=" + std::to_string(prefs->value().process_limit.value()));
+        }
+#endif
+
         auto view = saucer::smartview::create(options);
         if (!view.has_value())
         {
@@ -0,0 +1,164 @@
+#include "metrics.hpp"
+
+#include <bit>
+#include <mutex>
+
+namespace saucer_nodejs {
+namespace metrics {
+
+Counter loop_iterations;
+Histogram loop_time;
+Counter loop_tasks;
+Counter loop_coalesced;
+Counter tsfn_calls;
+Counter rpc_call_records;
+Counter tsfn_dropped;
+Histogram evaluate_latency;
+
+namespace {
+
+std::atomic<size_t> next_shard{0};
+
+std::mutex table_mutex;
+std::map<std::string, std::unique_ptr<RpcMetrics>> rpc_table;
+std::map<std::string, std::unique_ptr<SchemeMetrics>> scheme_table;
+
+constexpr double kNanosPerMilli = 1e6;
+
+} // namespace
+
+// ============================================================================
+// Counter
+// ============================================================================
+
+size_t Counter::ShardIndex() {
+  thread_local size_t index = next_shard.fetch_add(1, std::memory_order_relaxed) % kShards;
+  return index;
+}
+
+uint64_t Counter::Value() const {
+  uint64_t total = 0;
+  for (const auto& shard : shards_) {
+    total += shard.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+size_t Histogram::BucketIndex(uint64_t nanos) {
+  if (nanos < 16) {
+    return static_cast<size_t>(nanos);
+  }
+
+  size_t exponent = 63 - static_cast<size_t>(std::countl_zero(nanos));
+  size_t sub = static_cast<size_t>(nanos >> (exponent - kSubBits)) & ((1 << kSubBits) - 1);
+  return 16 + (exponent - 4) * (1 << kSubBits) + sub;
+}
+
+uint64_t Histogram::BucketMidpoint(size_t index) {
+  if (index < 16) {
+    return index;
+  }
+
+  size_t exponent = (index - 16) / (1 << kSubBits) + 4;
+  size_t sub = (index - 16) % (1 << kSubBits);
+  uint64_t width = uint64_t{1} << (exponent - kSubBits);
+  uint64_t low = ((uint64_t{1} << kSubBits) + sub) * width;
+  return low + width / 2;
+}
+
+void Histogram::Record(uint64_t nanos) {
+  buckets_[BucketIndex(nanos)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(nanos, std::memory_order_relaxed);
+
+  uint64_t current = min_.load(std::memory_order_relaxed);
+  while (nanos < current && !min_.compare_exchange_weak(current, nanos, std::memory_order_relaxed)) {
+  }
+
+  current = max_.load(std::memory_order_relaxed);
+  while (nanos > current && !max_.compare_exchange_weak(current, nanos, std::memory_order_relaxed)) {
+  }
+}
+
+Histogram::Summary Histogram::Summarize() const {
+  Summary summary;
+
+  std::array<uint64_t, kBuckets> counts;
+  uint64_t total = 0;
+  for (size_t i = 0; i < kBuckets; i++) {
+    counts[i] = buckets_[i].load(std::memory_order_relaxed);
+    total += counts[i];
+  }
+
+  if (total == 0) {
+    return summary;
+  }
+
+  auto percentile = [&](double q) {
+    uint64_t target = static_cast<uint64_t>(q * static_cast<double>(total) + 0.999999);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; i++) {
+      seen += counts[i];
+      if (seen >= target) {
+        return static_cast<double>(BucketMidpoint(i)) / kNanosPerMilli;
+      }
+    }
+    return static_cast<double>(max_.load(std::memory_order_relaxed)) / kNanosPerMilli;
+  };
+
+  summary.count = total;
+  summary.sum = static_cast<double>(sum_.load(std::memory_order_relaxed)) / kNanosPerMilli;
+  summary.min = static_cast<double>(min_.load(std::memory_order_relaxed)) / kNanosPerMilli;
+  summary.max = static_cast<double>(max_.load(std::memory_order_relaxed)) / kNanosPerMilli;
+  summary.p50 = percentile(0.50);
+  summary.p90 = percentile(0.90);
+  summary.p99 = percentile(0.99);
+  return summary;
+}
+
+// ============================================================================
+// Per-name tables
+// ============================================================================
+
+RpcMetrics& ForRpc(const std::string& name) {
+  std::scoped_lock lock(table_mutex);
+  auto& entry = rpc_table[name];
+  if (!entry) {
+    entry = std::make_unique<RpcMetrics>();
+  }
+  return *entry;
+}
+
+SchemeMetrics& ForScheme(const std::string& name) {
+  std::scoped_lock lock(table_mutex);
+  auto& entry = scheme_table[name];
+  if (!entry) {
+    entry = std::make_unique<SchemeMetrics>();
+  }
+  return *entry;
+}
+
+std::map<std::string, RpcMetrics*> RpcTable() {
+  std::scoped_lock lock(table_mutex);
+  std::map<std::string, RpcMetrics*> result;
+  for (const auto& [name, entry] : rpc_table) {
+    result.emplace(name, entry.get());
+  }
+  return result;
+}
+
+std::map<std::string, SchemeMetrics*> SchemeTable() {
+  std::scoped_lock lock(table_mutex);
+  std::map<std::string, SchemeMetrics*> result;
+  for (const auto& [name, entry] : scheme_table) {
+    result.emplace(name, entry.get());
+  }
+  return result;
+}
+
+} // namespace metrics
+} // namespace saucer_nodejs
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace saucer_nodejs {
+namespace metrics {
+
+// ============================================================================
+// Live metrics - always-on counters and latency histograms read by app.metrics()
+// ============================================================================
+
+// Counter sharded across cache lines; each thread adds to its own shard so hot
+// paths on the UI, Node and pool threads never contend on one atomic.
+class Counter {
+public:
+  void Add(uint64_t value = 1) {
+    shards_[ShardIndex()].value.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  uint64_t Value() const;
+
+private:
+  static constexpr size_t kShards = 16;
+
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> value{0};
+  };
+
+  static size_t ShardIndex();
+
+  std::array<Shard, kShards> shards_;
+};
+
+// Log-linear histogram (HDR-style, 8 sub-buckets per power of two, ~12.5% precision)
+// over nanosecond samples
+class Histogram {
+public:
+  struct Summary {
+    uint64_t count = 0;
+    double sum = 0;
+    double min = 0;
+    double max = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+  };
+
+  void Record(uint64_t nanos);
+
+  // Snapshot in milliseconds
+  Summary Summarize() const;
+
+private:
+  static constexpr size_t kSubBits = 3;
+  static constexpr size_t kBuckets = 16 + (64 - 4) * (1 << kSubBits);
+
+  static size_t BucketIndex(uint64_t nanos);
+  static uint64_t BucketMidpoint(size_t index);
+
+  std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> min_{UINT64_MAX};
+  std::atomic<uint64_t> max_{0};
+};
+
+struct RpcMetrics {
+  Counter calls;
+  Counter errors;
+  Histogram latency;
+};
+
+struct SchemeMetrics {
+  Counter requests;
+  Counter bytes;
+  Histogram latency;
+};
+
+// Process-wide metrics
+extern Counter loop_iterations;
+extern Histogram loop_time;
+extern Counter loop_tasks;  // post/dispatch tasks run by the UI loop
+extern Counter loop_coalesced;  // keyed post() tasks superseded or cancelled before they ran
+extern Counter tsfn_calls;
+extern Counter rpc_call_records;  // pooled exposed-call records ever allocated
+extern Counter tsfn_dropped;
+extern Histogram evaluate_latency;
+
+// Per-name metrics; look these up once at registration time and keep the reference
+RpcMetrics& ForRpc(const std::string& name);
+SchemeMetrics& ForScheme(const std::string& name);
+
+// Stable-address snapshots of the per-name tables (entries are never removed)
+std::map<std::string, RpcMetrics*> RpcTable();
+std::map<std::string, SchemeMetrics*> SchemeTable();
+
+// Count a TSFN call and whether the result was dropped (queue closing / full)
+inline void TrackCall(bool ok) {
+  tsfn_calls.Add();
+  if (!ok) {
+    tsfn_dropped.Add();
+  }
+}
+
+} // namespace metrics
+} // namespace saucer_nodejs
@@ -11,7 +11,11 @@
 #pragma once
 
 #include <napi.h>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace saucer_nodejs {
@@ -34,6 +38,10 @@ private:
   static Napi::Value ReadImage(const Napi::CallbackInfo& info);
   static void WriteImage(const Napi::CallbackInfo& info);
   
+  // Asynchronous reads (resolve through a TSFN instead of blocking on the clipboard owner)
+  static Napi::Value ReadTextAsync(const Napi::CallbackInfo& info);
+  static Napi::Value ReadImageAsync(const Napi::CallbackInfo& info);
+  
   // Check operations
   static Napi::Value HasText(const Napi::CallbackInfo& info);
   static Napi::Value HasImage(const Napi::CallbackInfo& info);
@@ -57,7 +65,10 @@ private:
   std::string body_;
   std::string icon_path_;
   
-  void Show(const Napi::CallbackInfo& info);
+  // Platform backend state (e.g. server id and click/close listeners on Linux)
+  std::shared_ptr<void> native_state_;
+  
+  Napi::Value Show(const Napi::CallbackInfo& info);
   
   static Napi::Value IsSupported(const Napi::CallbackInfo& info);
   static Napi::Value RequestPermission(const Napi::CallbackInfo& info);
@@ -97,11 +108,26 @@ private:
 
 // Forward declare the saucer handle type (from saucer bindings)
 struct saucer_handle;
+struct saucer_preferences;
 
 // Window Position
 void saucer_window_position_ext(saucer_handle* handle, int* x, int* y);
 void saucer_window_set_position_ext(saucer_handle* handle, int x, int y);
 
+// Whether moves are honoured (false on Wayland and where position is still a stub)
+bool saucer_window_position_supported_ext(saucer_handle* handle);
+
+// Window Geometry: constraints, size and position in a single native update. Returns false where the
+// platform has no combined path; the caller then falls back to the individual setters
+struct saucer_window_geometry_ext {
+  std::optional<std::pair<int, int>> min_size;
+  std::optional<std::pair<int, int>> max_size;
+  std::optional<std::pair<int, int>> size;
+  std::optional<std::pair<int, int>> position;
+};
+
+bool saucer_window_set_geometry_ext(saucer_handle* handle, const saucer_window_geometry_ext& geometry);
+
 // Window Fullscreen
 bool saucer_window_fullscreen_ext(saucer_handle* handle);
 void saucer_window_set_fullscreen_ext(saucer_handle* handle, bool enabled);
@@ -109,3 +135,33 @@ void saucer_window_set_fullscreen_ext(saucer_handle* handle, bool enabled);
 // Webview Zoom
 double saucer_webview_zoom_ext(saucer_handle* handle);
 void saucer_webview_set_zoom_ext(saucer_handle* handle, double level);
+
+// Web process model: begin selects the web context (one per sharedContext group, with the cache model and
+// process limit already set) that the next webview created on this thread is constructed with; end follows
+// saucer_new. begin returns false and fills *error when the options are unsupported by this backend
+bool saucer_webview_begin_context_ext(saucer_preferences* prefs, std::string* error);
+void saucer_webview_end_context_ext();
+
+// Non-blocking pickers: show the dialog and return at once. done runs on the UI thread with the selection, or
+// nullopt when dismissed or cancelled. Returns nullptr where the platform has no non-blocking chooser
+enum class saucer_picker_kind_ext { file, folder, files, folders };
+struct saucer_pick_request_ext;
+using saucer_pick_done_ext = std::function<void(std::optional<std::vector<std::string>>)>;
+
+saucer_pick_request_ext* saucer_desktop_pick_async_ext(saucer_picker_kind_ext kind, const std::optional<std::string>& initial,
+                                                       const std::vector<std::string>& filters, saucer_pick_done_ext done);
+
+// Closes the dialog and runs done with nullopt. The request is gone once done has run
+void saucer_desktop_pick_cancel_ext(saucer_pick_request_ext* request);
+
+// Native-owned main loop: the platform loop does the blocking wait and watches a libuv loop's
+// backend fd and next timer. attach returns false where the platform loop cannot watch libuv.
+// wait blocks in the platform loop until libuv has work due or *stop is set; it never runs libuv
+// itself, the caller returns to uv_run for that.
+struct uv_loop_s;
+bool saucer_loop_attach_uv_ext(uv_loop_s* loop);
+void saucer_loop_wait_uv_ext(const bool* stop);
+void saucer_loop_detach_uv_ext();
+
+// Whether the platform loop has events waiting (used by app.step({ untilIdle }))
+bool saucer_loop_pending_ext();
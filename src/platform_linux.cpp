@@ -7,7 +7,15 @@
 #if defined(__linux__) && !defined(__ANDROID__)
 
 #include <gtk/gtk.h>
+#include <gdk/gdkx.h>
+#include <uv.h>
+#include <algorithm>
 #include <cstring>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace saucer_nodejs {
 
@@ -19,6 +27,8 @@ Napi::Object Clipboard::Init(Napi::Env env, Napi::Object exports) {
   Napi::Object clipboard = Napi::Object::New(env);
   
   clipboard.Set("readText", Napi::Function::New(env, &Clipboard::ReadText));
+  clipboard.Set("readTextAsync", Napi::Function::New(env, &Clipboard::ReadTextAsync));
+  clipboard.Set("readImageAsync", Napi::Function::New(env, &Clipboard::ReadImageAsync));
   clipboard.Set("writeText", Napi::Function::New(env, &Clipboard::WriteText));
   clipboard.Set("hasText", Napi::Function::New(env, &Clipboard::HasText));
   clipboard.Set("hasImage", Napi::Function::New(env, &Clipboard::HasImage));
@@ -131,10 +141,577 @@ void Clipboard::Clear(const Napi::CallbackInfo& info) {
   gtk_clipboard_clear(clipboard);
 }
 
+// Asynchronous reads use gtk_clipboard_request_*: GTK calls back from the main loop (driven by the libuv
+// integration) once the owner answers, instead of spinning a nested loop like gtk_clipboard_wait_*. Results are
+// handed to JS through a TSFN so promise resolution happens in a proper callback scope.
+
+namespace {
+
+struct ClipboardResult {
+  std::optional<std::string> text;
+  std::vector<uint8_t> data;
+  int width = 0;
+  int height = 0;
+  bool has_image = false;
+};
+
+struct ClipboardRequest {
+  Napi::ThreadSafeFunction tsfn;
+  std::shared_ptr<Napi::Promise::Deferred> deferred;
+  bool image = false;
+  bool rgba = false;
+};
+
+ClipboardRequest* NewClipboardRequest(Napi::Env env, const char* name) {
+  auto* request = new ClipboardRequest();
+  request->deferred = std::make_shared<Napi::Promise::Deferred>(Napi::Promise::Deferred::New(env));
+  request->tsfn = Napi::ThreadSafeFunction::New(
+    env,
+    Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+    name,
+    0,
+    1
+  );
+  return request;
+}
+
+void CompleteClipboardRequest(ClipboardRequest* request, ClipboardResult* result) {
+  auto deferred = request->deferred;
+  bool image = request->image;
+  bool rgba = request->rgba;
+
+  auto status = request->tsfn.NonBlockingCall(result, [deferred, image, rgba](Napi::Env env, Napi::Function, ClipboardResult* data) {
+    if (!image) {
+      deferred->Resolve(Napi::String::New(env, data->text.value_or("")));
+    } else if (!data->has_image) {
+      deferred->Resolve(env.Null());
+    } else if (rgba) {
+      Napi::Object rtn = Napi::Object::New(env);
+      rtn.Set("width", Napi::Number::New(env, data->width));
+      rtn.Set("height", Napi::Number::New(env, data->height));
+      rtn.Set("data", Napi::Buffer<uint8_t>::Copy(env, data->data.data(), data->data.size()));
+      deferred->Resolve(rtn);
+    } else {
+      deferred->Resolve(Napi::Buffer<uint8_t>::Copy(env, data->data.data(), data->data.size()));
+    }
+
+    delete data;
+  });
+
+  if (status != napi_ok) {
+    delete result;
+  }
+
+  request->tsfn.Release();
+  delete request;
+}
+
+// Tightly packed 8-bit RGBA, straight from the pixbuf's pixel rows (no PNG round-trip)
+void CopyPixbufRGBA(GdkPixbuf* pixbuf, ClipboardResult* result) {
+  const int width = gdk_pixbuf_get_width(pixbuf);
+  const int height = gdk_pixbuf_get_height(pixbuf);
+  const int stride = gdk_pixbuf_get_rowstride(pixbuf);
+  const int channels = gdk_pixbuf_get_n_channels(pixbuf);
+  const bool alpha = gdk_pixbuf_get_has_alpha(pixbuf);
+  const guchar* pixels = gdk_pixbuf_read_pixels(pixbuf);
+
+  result->width = width;
+  result->height = height;
+  result->data.resize(static_cast<size_t>(width) * height * 4);
+
+  for (int y = 0; y < height; ++y) {
+    const guchar* src = pixels + static_cast<size_t>(y) * stride;
+    uint8_t* dst = result->data.data() + static_cast<size_t>(y) * width * 4;
+
+    if (alpha && channels == 4) {
+      std::memcpy(dst, src, static_cast<size_t>(width) * 4);
+      continue;
+    }
+
+    for (int x = 0; x < width; ++x, src += channels, dst += 4) {
+      dst[0] = src[0];
+      dst[1] = src[1];
+      dst[2] = src[2];
+      dst[3] = alpha ? src[3] : 255;
+    }
+  }
+}
+
+void OnClipboardText(GtkClipboard*, const gchar* text, gpointer userdata) {
+  auto* result = new ClipboardResult();
+  if (text) {
+    result->text = text;
+  }
+  CompleteClipboardRequest(static_cast<ClipboardRequest*>(userdata), result);
+}
+
+void OnClipboardImage(GtkClipboard*, GdkPixbuf* pixbuf, gpointer userdata) {
+  auto* request = static_cast<ClipboardRequest*>(userdata);
+  auto* result = new ClipboardResult();
+
+  if (pixbuf && request->rgba) {
+    CopyPixbufRGBA(pixbuf, result);
+    result->has_image = true;
+  } else if (pixbuf) {
+    gchar* buffer = nullptr;
+    gsize size = 0;
+    GError* error = nullptr;
+
+    if (gdk_pixbuf_save_to_buffer(pixbuf, &buffer, &size, "png", &error, nullptr)) {
+      result->data.assign(reinterpret_cast<uint8_t*>(buffer), reinterpret_cast<uint8_t*>(buffer) + size);
+      result->has_image = true;
+      g_free(buffer);
+    }
+
+    if (error) g_error_free(error);
+  }
+
+  // The pixbuf is owned by GTK for the duration of the callback
+  CompleteClipboardRequest(request, result);
+}
+
+} // namespace
+
+Napi::Value Clipboard::ReadTextAsync(const Napi::CallbackInfo& info) {
+  ClipboardRequest* request = NewClipboardRequest(info.Env(), "saucer.clipboard.readText");
+  Napi::Promise promise = request->deferred->Promise();
+
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  gtk_clipboard_request_text(clipboard, &OnClipboardText, request);
+
+  return promise;
+}
+
+Napi::Value Clipboard::ReadImageAsync(const Napi::CallbackInfo& info) {
+  ClipboardRequest* request = NewClipboardRequest(info.Env(), "saucer.clipboard.readImage");
+  Napi::Promise promise = request->deferred->Promise();
+
+  request->image = true;
+  if (info.Length() > 0 && info[0].IsObject()) {
+    Napi::Object opts = info[0].As<Napi::Object>();
+    if (opts.Has("format") && opts.Get("format").IsString()) {
+      request->rgba = opts.Get("format").As<Napi::String>().Utf8Value() == "rgba";
+    }
+  }
+
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  gtk_clipboard_request_image(clipboard, &OnClipboardImage, request);
+
+  return promise;
+}
+
 // ============================================================================
-// Notification Implementation (Linux/libnotify)
+// Notification Implementation (Linux/GDBus, org.freedesktop.Notifications)
 // ============================================================================
 
+// One session-bus connection is kept for the process. It is opened asynchronously, and Notify calls, the server
+// probe and the ActionInvoked/NotificationClosed signals are dispatched on the default main context, which the
+// saucer loop iterates on the JS thread; JS is only ever entered through the per-notification TSFN. The backend is
+// bound to the env that creates the first notification and drops every JS reference in that env's cleanup hook.
+
+namespace {
+
+constexpr const char* kNotifyName = "org.freedesktop.Notifications";
+constexpr const char* kNotifyPath = "/org/freedesktop/Notifications";
+
+// Token bucket: bursts of up to kRateBurst notifications, then kRatePerSecond. Anything beyond that is queued
+// and coalesced per notification, so a flood of updates to one alert only sends the newest content.
+constexpr double kRateBurst = 8;
+constexpr double kRatePerSecond = 4;
+constexpr size_t kMaxPending = 64;
+
+// Servers that keep notifications in a history may never send NotificationClosed. Listeners still registered
+// this long after their last Notify are dropped, and onClose gets reason 4 ("undefined")
+constexpr gint64 kListenerTtl = 10 * 60 * G_USEC_PER_SEC;
+constexpr guint kSweepSeconds = 60;
+constexpr uint32_t kReasonUndefined = 4;
+
+struct NotificationEvent {
+  // Dropped resolves show() with null: no bus or server, or the rate limiter gave up on the entry
+  enum class Kind { Shown, Dropped, Failed, Click, Closed };
+
+  Kind kind;
+  uint32_t id = 0;
+  uint32_t reason = 0;
+  std::string text;
+  std::vector<std::shared_ptr<Napi::Promise::Deferred>> deferreds;
+};
+
+struct NotificationListener : std::enable_shared_from_this<NotificationListener> {
+  uint32_t id = 0;
+  gint64 notified_at = 0;
+  bool released = false;
+  Napi::ThreadSafeFunction tsfn;
+  Napi::FunctionReference on_click;
+  Napi::FunctionReference on_close;
+
+  ~NotificationListener() {
+    Release();
+  }
+
+  // Drops the JS references while their env is still alive; later events are discarded
+  void Release() {
+    if (released) {
+      return;
+    }
+
+    released = true;
+    on_click.Reset();
+    on_close.Reset();
+    tsfn.Release();
+  }
+
+  void Emit(NotificationEvent* event) {
+    if (released) {
+      delete event;
+      return;
+    }
+
+    auto self = shared_from_this();
+    auto status = tsfn.NonBlockingCall(event, [self](Napi::Env env, Napi::Function, NotificationEvent* data) {
+      switch (data->kind) {
+        case NotificationEvent::Kind::Shown:
+          for (auto& deferred : data->deferreds) deferred->Resolve(Napi::Number::New(env, data->id));
+          break;
+        case NotificationEvent::Kind::Dropped:
+          for (auto& deferred : data->deferreds) deferred->Resolve(env.Null());
+          break;
+        case NotificationEvent::Kind::Failed:
+          for (auto& deferred : data->deferreds) deferred->Reject(Napi::Error::New(env, data->text).Value());
+          break;
+        case NotificationEvent::Kind::Click:
+          if (!self->on_click.IsEmpty()) self->on_click.Call({Napi::String::New(env, data->text)});
+          break;
+        case NotificationEvent::Kind::Closed:
+          if (!self->on_close.IsEmpty()) self->on_close.Call({Napi::Number::New(env, data->reason)});
+          break;
+      }
+      delete data;
+    });
+
+    if (status != napi_ok) {
+      delete event;
+    }
+  }
+};
+
+struct PendingNotification {
+  std::shared_ptr<NotificationListener> listener;
+  std::string title;
+  std::string body;
+  std::string icon;
+  std::vector<std::shared_ptr<Napi::Promise::Deferred>> deferreds;
+};
+
+struct NotificationBackend {
+  enum class Bus { Idle, Connecting, Ready, Missing };
+
+  napi_env env = nullptr;
+  Bus bus = Bus::Idle;
+  GDBusConnection* connection = nullptr;
+  std::optional<bool> supported;
+
+  // Every listener created in the bound env, so the cleanup hook can release them
+  std::vector<std::weak_ptr<NotificationListener>> listeners;
+
+  // Listeners of notifications that are (or may still be) on screen, keyed by server id
+  std::unordered_map<uint32_t, std::shared_ptr<NotificationListener>> active;
+  std::deque<PendingNotification> pending;
+
+  double tokens = kRateBurst;
+  gint64 last_refill = 0;
+  guint drain_source = 0;
+  guint sweep_source = 0;
+
+  static NotificationBackend& Get() {
+    static NotificationBackend instance;
+    return instance;
+  }
+
+  // Notifications belong to the first env that uses them (a worker loading the addon gets none)
+  bool Bind(Napi::Env target) {
+    if (env == nullptr) {
+      env = target;
+      napi_add_env_cleanup_hook(env, &NotificationBackend::OnEnvCleanup, nullptr);
+    }
+
+    return env == static_cast<napi_env>(target);
+  }
+
+  void Track(const std::shared_ptr<NotificationListener>& listener) {
+    listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+      [](const std::weak_ptr<NotificationListener>& entry) { return entry.expired(); }), listeners.end());
+    listeners.push_back(listener);
+  }
+
+  static void OnEnvCleanup(void*) {
+    auto& backend = Get();
+
+    for (auto& entry : backend.listeners) {
+      if (auto listener = entry.lock()) {
+        listener->Release();
+      }
+    }
+
+    backend.listeners.clear();
+    backend.active.clear();
+    backend.pending.clear();
+
+    if (backend.drain_source) {
+      g_source_remove(backend.drain_source);
+      backend.drain_source = 0;
+    }
+    if (backend.sweep_source) {
+      g_source_remove(backend.sweep_source);
+      backend.sweep_source = 0;
+    }
+
+    backend.env = nullptr;
+  }
+
+  void Connect() {
+    if (bus != Bus::Idle) {
+      return;
+    }
+
+    bus = Bus::Connecting;
+    g_bus_get(G_BUS_TYPE_SESSION, nullptr, &NotificationBackend::OnBusReady, nullptr);
+  }
+
+  static void OnBusReady(GObject*, GAsyncResult* result, gpointer) {
+    auto& backend = Get();
+
+    GError* error = nullptr;
+    backend.connection = g_bus_get_finish(result, &error);
+    if (error) g_error_free(error);
+
+    if (!backend.connection) {
+      backend.bus = Bus::Missing;
+      backend.supported = false;
+
+      for (auto& entry : backend.pending) {
+        entry.listener->Emit(new NotificationEvent{NotificationEvent::Kind::Dropped, 0, 0, {}, std::move(entry.deferreds)});
+      }
+      backend.pending.clear();
+      return;
+    }
+
+    backend.bus = Bus::Ready;
+    g_dbus_connection_signal_subscribe(backend.connection, nullptr, kNotifyName, nullptr, kNotifyPath, nullptr,
+      G_DBUS_SIGNAL_FLAGS_NONE, &NotificationBackend::OnSignal, nullptr, nullptr);
+
+    // A notification server has to answer on the bus; isSupported() reports this once it is known
+    g_dbus_connection_call(backend.connection, kNotifyName, kNotifyPath, kNotifyName, "GetServerInformation", nullptr,
+      G_VARIANT_TYPE("(ssss)"), G_DBUS_CALL_FLAGS_NONE, 1000, nullptr, &NotificationBackend::OnServerInformation, nullptr);
+
+    // Notifications queued while connecting go out under the usual rate limit
+    OnDrain(nullptr);
+  }
+
+  static void OnServerInformation(GObject* source, GAsyncResult* result, gpointer) {
+    GVariant* reply = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), result, nullptr);
+    Get().supported = reply != nullptr;
+    if (reply) g_variant_unref(reply);
+  }
+
+  bool TakeToken() {
+    gint64 now = g_get_monotonic_time();
+    if (last_refill != 0) {
+      tokens = std::min(kRateBurst, tokens + (now - last_refill) / 1e6 * kRatePerSecond);
+    }
+    last_refill = now;
+
+    if (tokens < 1) {
+      return false;
+    }
+
+    tokens -= 1;
+    return true;
+  }
+
+  void Submit(PendingNotification notification) {
+    Connect();
+
+    if (bus == Bus::Missing) {
+      notification.listener->Emit(new NotificationEvent{NotificationEvent::Kind::Dropped, 0, 0, {},
+        std::move(notification.deferreds)});
+      return;
+    }
+
+    if (bus == Bus::Ready && pending.empty() && TakeToken()) {
+      Send(std::move(notification));
+      return;
+    }
+
+    auto existing = std::find_if(pending.begin(), pending.end(), [&](const PendingNotification& entry) {
+      return entry.listener == notification.listener;
+    });
+
+    if (existing != pending.end()) {
+      existing->title = std::move(notification.title);
+      existing->body = std::move(notification.body);
+      existing->icon = std::move(notification.icon);
+      existing->deferreds.insert(existing->deferreds.end(), notification.deferreds.begin(), notification.deferreds.end());
+    } else {
+      if (pending.size() >= kMaxPending) {
+        auto dropped = std::move(pending.front());
+        pending.pop_front();
+        dropped.listener->Emit(new NotificationEvent{NotificationEvent::Kind::Dropped, 0, 0, {}, std::move(dropped.deferreds)});
+      }
+      pending.push_back(std::move(notification));
+    }
+
+    // While connecting, OnBusReady starts the drain
+    if (bus == Bus::Ready && !drain_source) {
+      drain_source = g_timeout_add(static_cast<guint>(1000 / kRatePerSecond), &NotificationBackend::OnDrain, nullptr);
+    }
+  }
+
+  void Send(PendingNotification notification) {
+    GVariantBuilder actions;
+    g_variant_builder_init(&actions, G_VARIANT_TYPE("as"));
+    if (!notification.listener->on_click.IsEmpty()) {
+      g_variant_builder_add(&actions, "s", "default");
+      g_variant_builder_add(&actions, "s", "Open");
+    }
+
+    GVariantBuilder hints;
+    g_variant_builder_init(&hints, G_VARIANT_TYPE("a{sv}"));
+
+    GVariant* params = g_variant_new("(susssasa{sv}i)", "saucer", notification.listener->id, notification.icon.c_str(),
+      notification.title.c_str(), notification.body.c_str(), &actions, &hints, -1);
+
+    auto* context = new PendingNotification(std::move(notification));
+    g_dbus_connection_call(connection, kNotifyName, kNotifyPath, kNotifyName, "Notify", params, G_VARIANT_TYPE("(u)"),
+      G_DBUS_CALL_FLAGS_NONE, -1, nullptr, &NotificationBackend::OnNotifyReply, context);
+  }
+
+  static void OnNotifyReply(GObject* source, GAsyncResult* result, gpointer userdata) {
+    std::unique_ptr<PendingNotification> context(static_cast<PendingNotification*>(userdata));
+    auto& backend = Get();
+
+    GError* error = nullptr;
+    GVariant* reply = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), result, &error);
+
+    if (!reply) {
+      // No notification server on the bus is "unsupported", not a failure of this call
+      bool missing = error && g_error_matches(error, G_DBUS_ERROR, G_DBUS_ERROR_SERVICE_UNKNOWN);
+      std::string message = error ? error->message : "Notify call failed";
+      if (error) g_error_free(error);
+
+      if (missing) {
+        backend.supported = false;
+        context->listener->Emit(new NotificationEvent{NotificationEvent::Kind::Dropped, 0, 0, {}, std::move(context->deferreds)});
+      } else {
+        context->listener->Emit(new NotificationEvent{NotificationEvent::Kind::Failed, 0, 0, message, std::move(context->deferreds)});
+      }
+      return;
+    }
+
+    uint32_t id = 0;
+    g_variant_get(reply, "(u)", &id);
+    g_variant_unref(reply);
+
+    // The env went away while the call was in flight
+    if (context->listener->released) {
+      return;
+    }
+
+    if (context->listener->id != 0 && context->listener->id != id) {
+      backend.active.erase(context->listener->id);
+    }
+
+    context->listener->id = id;
+    context->listener->notified_at = g_get_monotonic_time();
+    backend.active[id] = context->listener;
+    context->listener->Emit(new NotificationEvent{NotificationEvent::Kind::Shown, id, 0, {}, std::move(context->deferreds)});
+
+    if (!backend.sweep_source) {
+      backend.sweep_source = g_timeout_add_seconds(kSweepSeconds, &NotificationBackend::OnSweep, nullptr);
+    }
+  }
+
+  static void OnSignal(GDBusConnection*, const gchar*, const gchar*, const gchar*, const gchar* signal,
+                       GVariant* parameters, gpointer) {
+    auto& backend = Get();
+    uint32_t id = 0;
+
+    if (std::strcmp(signal, "ActionInvoked") == 0) {
+      const gchar* action = nullptr;
+      g_variant_get(parameters, "(u&s)", &id, &action);
+
+      auto it = backend.active.find(id);
+      if (it != backend.active.end()) {
+        it->second->Emit(new NotificationEvent{NotificationEvent::Kind::Click, id, 0, action ? action : "", {}});
+      }
+    } else if (std::strcmp(signal, "NotificationClosed") == 0) {
+      uint32_t reason = 0;
+      g_variant_get(parameters, "(uu)", &id, &reason);
+
+      auto it = backend.active.find(id);
+      if (it != backend.active.end()) {
+        auto listener = it->second;
+        backend.active.erase(it);
+        listener->id = 0;
+        listener->Emit(new NotificationEvent{NotificationEvent::Kind::Closed, id, reason, {}, {}});
+      }
+    }
+  }
+
+  static gboolean OnSweep(gpointer) {
+    auto& backend = Get();
+    gint64 cutoff = g_get_monotonic_time() - kListenerTtl;
+
+    for (auto it = backend.active.begin(); it != backend.active.end();) {
+      if (it->second->notified_at > cutoff) {
+        ++it;
+        continue;
+      }
+
+      auto listener = it->second;
+      it = backend.active.erase(it);
+      listener->id = 0;
+      listener->Emit(new NotificationEvent{NotificationEvent::Kind::Closed, 0, kReasonUndefined, {}, {}});
+    }
+
+    if (backend.active.empty()) {
+      backend.sweep_source = 0;
+      return G_SOURCE_REMOVE;
+    }
+
+    return G_SOURCE_CONTINUE;
+  }
+
+  static gboolean OnDrain(gpointer) {
+    auto& backend = Get();
+
+    while (!backend.pending.empty() && backend.TakeToken()) {
+      auto next = std::move(backend.pending.front());
+      backend.pending.pop_front();
+      backend.Send(std::move(next));
+    }
+
+    if (backend.pending.empty()) {
+      backend.drain_source = 0;
+      return G_SOURCE_REMOVE;
+    }
+
+    // Called directly from OnBusReady: keep draining from a timer
+    if (!backend.drain_source) {
+      backend.drain_source = g_timeout_add(static_cast<guint>(1000 / kRatePerSecond), &NotificationBackend::OnDrain, nullptr);
+      return G_SOURCE_REMOVE;
+    }
+
+    return G_SOURCE_CONTINUE;
+  }
+};
+
+std::shared_ptr<NotificationListener> GetListener(const std::shared_ptr<void>& state) {
+  return std::static_pointer_cast<NotificationListener>(state);
+}
+
+} // namespace
+
 Napi::Object Notification::Init(Napi::Env env, Napi::Object exports) {
   Napi::Function func = DefineClass(env, "Notification", {
     InstanceMethod("show", &Notification::Show),
@@ -151,6 +728,25 @@ Napi::Object Notification::Init(Napi::Env env, Napi::Object exports) {
 
 Notification::Notification(const Napi::CallbackInfo& info) 
   : Napi::ObjectWrap<Notification>(info) {
+  Napi::Env env = info.Env();
+
+  if (!NotificationBackend::Get().Bind(env)) {
+    Napi::Error::New(env, "Notifications are only available in the environment that first created one").ThrowAsJavaScriptException();
+    return;
+  }
+
+  auto listener = std::make_shared<NotificationListener>();
+
+  // The TSFN never keeps the process alive on its own
+  listener->tsfn = Napi::ThreadSafeFunction::New(
+    env,
+    Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+    "saucer.notification",
+    0,
+    1
+  );
+  listener->tsfn.Unref(env);
+
   if (info.Length() > 0 && info[0].IsObject()) {
     Napi::Object opts = info[0].As<Napi::Object>();
     
@@ -160,22 +756,68 @@ Notification::Notification(const Napi::CallbackInfo& info)
     if (opts.Has("body") && opts.Get("body").IsString()) {
       body_ = opts.Get("body").As<Napi::String>().Utf8Value();
     }
+    if (opts.Has("icon") && opts.Get("icon").IsString()) {
+      icon_path_ = opts.Get("icon").As<Napi::String>().Utf8Value();
+    }
+    if (opts.Has("onClick") && opts.Get("onClick").IsFunction()) {
+      listener->on_click = Napi::Persistent(opts.Get("onClick").As<Napi::Function>());
+    }
+    if (opts.Has("onClose") && opts.Get("onClose").IsFunction()) {
+      listener->on_close = Napi::Persistent(opts.Get("onClose").As<Napi::Function>());
+    }
   }
+
+  NotificationBackend::Get().Track(listener);
+  native_state_ = listener;
 }
 
 Notification::~Notification() {}
 
-void Notification::Show(const Napi::CallbackInfo& info) {
-  // Use notify-send as a simple fallback
-  // For proper implementation, would use libnotify directly
-  std::string cmd = "notify-send \"" + title_ + "\" \"" + body_ + "\" 2>/dev/null &";
-  system(cmd.c_str());
+Napi::Value Notification::Show(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  auto deferred = std::make_shared<Napi::Promise::Deferred>(Napi::Promise::Deferred::New(env));
+
+  // Optional overrides; a notification that was already shown is updated in place via its server id
+  if (info.Length() > 0 && info[0].IsObject()) {
+    Napi::Object opts = info[0].As<Napi::Object>();
+    if (opts.Has("title") && opts.Get("title").IsString()) {
+      title_ = opts.Get("title").As<Napi::String>().Utf8Value();
+    }
+    if (opts.Has("body") && opts.Get("body").IsString()) {
+      body_ = opts.Get("body").As<Napi::String>().Utf8Value();
+    }
+    if (opts.Has("icon") && opts.Get("icon").IsString()) {
+      icon_path_ = opts.Get("icon").As<Napi::String>().Utf8Value();
+    }
+  }
+
+  NotificationBackend::Get().Submit({GetListener(native_state_), title_, body_, icon_path_, {deferred}});
+  return deferred->Promise();
 }
 
 Napi::Value Notification::IsSupported(const Napi::CallbackInfo& info) {
-  // Check if notify-send is available
-  int result = system("which notify-send > /dev/null 2>&1");
-  return Napi::Boolean::New(info.Env(), result == 0);
+  auto& backend = NotificationBackend::Get();
+
+  // Never blocks: the bus connection and the server probe run asynchronously. Until the probe answers, a
+  // reachable session bus is taken as support, and show() resolves null if no server turns up after all
+  backend.Connect();
+
+  if (backend.supported.has_value()) {
+    return Napi::Boolean::New(info.Env(), *backend.supported);
+  }
+
+  if (backend.bus == NotificationBackend::Bus::Missing) {
+    return Napi::Boolean::New(info.Env(), false);
+  }
+
+  bool bus_address = g_getenv("DBUS_SESSION_BUS_ADDRESS") != nullptr;
+  if (!bus_address) {
+    gchar* socket = g_build_filename(g_get_user_runtime_dir(), "bus", nullptr);
+    bus_address = g_file_test(socket, G_FILE_TEST_EXISTS);
+    g_free(socket);
+  }
+
+  return Napi::Boolean::New(info.Env(), bus_address);
 }
 
 Napi::Value Notification::RequestPermission(const Napi::CallbackInfo& info) {
@@ -264,35 +906,436 @@ void SystemTray::OnClick(const Napi::CallbackInfo& info) {
 // ============================================================================
 // Window/Webview Extensions Implementation (Linux)
 // These are in global namespace to match the saucer_handle type
-// TODO: Implement using GTK and WebKitGTK APIs
 // ============================================================================
 
+// Include saucer headers to access native() method
+#include <saucer/modules/stable/webkitgtk.hpp>
+#include <webkit2/webkit2.h>
+
+// Import the webview handle definition
+#include "private/webview.hpp"
+#include "private/preferences.hpp"
+
+namespace {
+
+GtkWindow* NativeWindow(saucer_handle* handle) {
+  auto natives = handle->view.parent().native<true>();
+  return natives.window ? GTK_WINDOW(natives.window) : nullptr;
+}
+
+WebKitWebView* NativeWebview(saucer_handle* handle) {
+  auto natives = handle->view.native<true>();
+  return natives.webview ? WEBKIT_WEB_VIEW(natives.webview) : nullptr;
+}
+
+} // namespace
+
+// Note: Wayland compositors do not expose or accept global window coordinates, so position reads
+// 0,0 and moves are ignored there; on X11 these map directly to the window manager frame.
+
 void saucer_window_position_ext(saucer_handle* handle, int* x, int* y) {
-  // TODO: Use gtk_window_get_position
   *x = 0;
   *y = 0;
+
+  if (GtkWindow* window = NativeWindow(handle)) {
+    gtk_window_get_position(window, x, y);
+  }
 }
 
 void saucer_window_set_position_ext(saucer_handle* handle, int x, int y) {
-  // TODO: Use gtk_window_move
+  if (GtkWindow* window = NativeWindow(handle)) {
+    gtk_window_move(window, x, y);
+  }
+}
+
+bool saucer_window_position_supported_ext(saucer_handle* handle) {
+  GtkWindow* window = NativeWindow(handle);
+  return window && GDK_IS_X11_DISPLAY(gtk_widget_get_display(GTK_WIDGET(window)));
+}
+
+bool saucer_window_set_geometry_ext(saucer_handle* handle, const saucer_window_geometry_ext& geometry) {
+  GtkWindow* window = NativeWindow(handle);
+  if (!window) {
+    return false;
+  }
+
+  // Both bounds go out as one hint set so the window manager never sees a half-updated range
+  GdkGeometry hints{};
+  int mask = 0;
+
+  if (geometry.min_size) {
+    hints.min_width = geometry.min_size->first;
+    hints.min_height = geometry.min_size->second;
+    mask |= GDK_HINT_MIN_SIZE;
+  }
+
+  if (geometry.max_size) {
+    // saucer uses 0 for "unbounded"
+    hints.max_width = geometry.max_size->first > 0 ? geometry.max_size->first : G_MAXSHORT;
+    hints.max_height = geometry.max_size->second > 0 ? geometry.max_size->second : G_MAXSHORT;
+    mask |= GDK_HINT_MAX_SIZE;
+  }
+
+  if (mask) {
+    gtk_window_set_geometry_hints(window, nullptr, &hints, static_cast<GdkWindowHints>(mask));
+  }
+
+  if (geometry.size) {
+    gtk_window_resize(window, geometry.size->first, geometry.size->second);
+  }
+
+  if (geometry.position) {
+    gtk_window_move(window, geometry.position->first, geometry.position->second);
+  }
+
+  return true;
 }
 
 bool saucer_window_fullscreen_ext(saucer_handle* handle) {
-  // TODO: Check GdkWindowState
-  return false;
+  GtkWindow* window = NativeWindow(handle);
+  if (!window) {
+    return false;
+  }
+
+  GdkWindow* gdk_window = gtk_widget_get_window(GTK_WIDGET(window));
+  if (!gdk_window) {
+    return false;
+  }
+
+  return (gdk_window_get_state(gdk_window) & GDK_WINDOW_STATE_FULLSCREEN) != 0;
 }
 
 void saucer_window_set_fullscreen_ext(saucer_handle* handle, bool enabled) {
-  // TODO: Use gtk_window_fullscreen / gtk_window_unfullscreen
+  if (GtkWindow* window = NativeWindow(handle)) {
+    if (enabled) {
+      gtk_window_fullscreen(window);
+    } else {
+      gtk_window_unfullscreen(window);
+    }
+  }
 }
 
 double saucer_webview_zoom_ext(saucer_handle* handle) {
-  // TODO: Use webkit_web_view_get_zoom_level
+  if (WebKitWebView* webview = NativeWebview(handle)) {
+    return webkit_web_view_get_zoom_level(webview);
+  }
   return 1.0;
 }
 
 void saucer_webview_set_zoom_ext(saucer_handle* handle, double level) {
-  // TODO: Use webkit_web_view_set_zoom_level
+  if (WebKitWebView* webview = NativeWebview(handle)) {
+    webkit_web_view_set_zoom_level(webview, level);
+  }
+}
+
+namespace {
+
+// Contexts are created on the UI thread and live for the rest of the process: their webviews hold references,
+// and a group can be joined again after all of its windows closed
+std::unordered_map<std::string, WebKitWebContext*> context_groups;
+WebKitWebContext* pending_context = nullptr;
+GObject* (*webview_constructor)(GType, guint, GObjectConstructParam*) = nullptr;
+
+// saucer constructs its WebKitWebView internally, so the context is swapped into the construct-only
+// "web-context" property on the way through the class constructor
+GObject* ConstructWebview(GType type, guint count, GObjectConstructParam* params) {
+  if (pending_context) {
+    for (guint i = 0; i < count; ++i) {
+      if (std::strcmp(g_param_spec_get_name(params[i].pspec), "web-context") == 0) {
+        g_value_set_object(params[i].value, pending_context);
+      }
+    }
+  }
+
+  return webview_constructor(type, count, params);
+}
+
+void InstallWebviewConstructor() {
+  if (webview_constructor) {
+    return;
+  }
+
+  // Subclasses initialised later copy this slot from the parent class, so they are covered too
+  auto* klass = G_OBJECT_CLASS(g_type_class_ref(WEBKIT_TYPE_WEB_VIEW));
+  webview_constructor = klass->constructor;
+  klass->constructor = &ConstructWebview;
+}
+
+WebKitWebContext* CreateContext(const saucer_preferences_data& data) {
+  WebKitWebsiteDataManager* manager = nullptr;
+
+  if (data.storage_path) {
+    std::string path = data.storage_path->string();
+    manager = webkit_website_data_manager_new("base-data-directory", path.c_str(), "base-cache-directory",
+                                              path.c_str(), nullptr);
+  } else if (data.persistent_cookies) {
+    manager = webkit_website_data_manager_new(nullptr);
+  } else {
+    manager = webkit_website_data_manager_new_ephemeral();
+  }
+
+  WebKitWebContext* context = webkit_web_context_new_with_website_data_manager(manager);
+  g_object_unref(manager);
+
+  if (data.persistent_cookies && data.storage_path) {
+    std::string cookies = (*data.storage_path / "cookies.sqlite").string();
+    webkit_cookie_manager_set_persistent_storage(webkit_web_context_get_cookie_manager(context), cookies.c_str(),
+                                                 WEBKIT_COOKIE_PERSISTENT_STORAGE_SQLITE);
+  }
+
+  // Both only take effect before the first web process is spawned, i.e. before any view uses the context
+  switch (data.cache_model) {
+    case SAUCER_CACHE_MODEL_DOCUMENT_VIEWER:
+      webkit_web_context_set_cache_model(context, WEBKIT_CACHE_MODEL_DOCUMENT_VIEWER);
+      break;
+    case SAUCER_CACHE_MODEL_DOCUMENT_BROWSER:
+      webkit_web_context_set_cache_model(context, WEBKIT_CACHE_MODEL_DOCUMENT_BROWSER);
+      break;
+    case SAUCER_CACHE_MODEL_WEB_BROWSER:
+      webkit_web_context_set_cache_model(context, WEBKIT_CACHE_MODEL_WEB_BROWSER);
+      break;
+    case SAUCER_CACHE_MODEL_DEFAULT:
+      break;
+  }
+
+#ifndef WEBKIT_TYPE_NETWORK_SESSION
+  if (data.process_limit) {
+    // Deprecated since WebKitGTK 2.26 (site isolation decides process reuse there), still honoured by older releases
+    G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+    webkit_web_context_set_web_process_count_limit(context, static_cast<guint>(data.process_limit.value()));
+    G_GNUC_END_IGNORE_DEPRECATIONS
+  }
+#endif
+
+  return context;
+}
+
+} // namespace
+
+bool saucer_webview_begin_context_ext(saucer_preferences* prefs, std::string* error) {
+  const auto& data = prefs->value();
+
+#ifdef WEBKIT_TYPE_NETWORK_SESSION
+  // webkitgtk-6.0 removed the web process count limit altogether
+  if (data.process_limit) {
+    *error = "processLimit is not supported on webkitgtk-6.0";
+    return false;
+  }
+#endif
+
+  if (!data.shared_context && data.cache_model == SAUCER_CACHE_MODEL_DEFAULT && !data.process_limit) {
+    return true;
+  }
+
+  InstallWebviewConstructor();
+
+  if (!data.shared_context) {
+    // Not shared: a private context still lets the cache model / limit be set before first use
+    pending_context = CreateContext(data);
+    return true;
+  }
+
+  // The first member of a group decides its storage, cache model and limit
+  auto [it, inserted] = context_groups.try_emplace(data.shared_context.value(), nullptr);
+  if (inserted) {
+    it->second = CreateContext(data);
+  }
+
+  pending_context = WEBKIT_WEB_CONTEXT(g_object_ref(it->second));
+  return true;
+}
+
+void saucer_webview_end_context_ext() {
+  // The view (if one was created) holds its own reference
+  g_clear_object(&pending_context);
+}
+
+// ============================================================================
+// Non-blocking pickers (GtkFileChooserNative, which goes through the portal when sandboxed)
+// ============================================================================
+
+struct saucer_pick_request_ext {
+  GtkFileChooserNative* dialog;
+  saucer_pick_done_ext done;
+};
+
+namespace {
+
+void FinishPick(saucer_pick_request_ext* request, std::optional<std::vector<std::string>> selection) {
+  auto done = std::move(request->done);
+
+  g_signal_handlers_disconnect_by_data(request->dialog, request);
+  gtk_native_dialog_destroy(GTK_NATIVE_DIALOG(request->dialog));
+  g_object_unref(request->dialog);
+  delete request;
+
+  done(std::move(selection));
+}
+
+void OnPickResponse(GtkNativeDialog* dialog, gint response, gpointer data) {
+  std::optional<std::vector<std::string>> selection;
+
+  if (response == GTK_RESPONSE_ACCEPT) {
+    selection.emplace();
+
+    GSList* files = gtk_file_chooser_get_filenames(GTK_FILE_CHOOSER(dialog));
+    for (GSList* it = files; it; it = it->next) {
+      selection->emplace_back(static_cast<const char*>(it->data));
+    }
+    g_slist_free_full(files, g_free);
+  }
+
+  FinishPick(static_cast<saucer_pick_request_ext*>(data), std::move(selection));
+}
+
+} // namespace
+
+saucer_pick_request_ext* saucer_desktop_pick_async_ext(saucer_picker_kind_ext kind, const std::optional<std::string>& initial,
+                                                       const std::vector<std::string>& filters, saucer_pick_done_ext done) {
+  bool folders = kind == saucer_picker_kind_ext::folder || kind == saucer_picker_kind_ext::folders;
+  bool multiple = kind == saucer_picker_kind_ext::files || kind == saucer_picker_kind_ext::folders;
+
+  GtkFileChooserNative* dialog = gtk_file_chooser_native_new(
+    folders ? "Select Folder" : "Open File", nullptr,
+    folders ? GTK_FILE_CHOOSER_ACTION_SELECT_FOLDER : GTK_FILE_CHOOSER_ACTION_OPEN,
+    folders ? "_Select" : "_Open", "_Cancel");
+
+  GtkFileChooser* chooser = GTK_FILE_CHOOSER(dialog);
+  gtk_file_chooser_set_select_multiple(chooser, multiple);
+
+  if (initial) {
+    if (g_file_test(initial->c_str(), G_FILE_TEST_IS_DIR)) {
+      gtk_file_chooser_set_current_folder(chooser, initial->c_str());
+    } else {
+      gtk_file_chooser_set_filename(chooser, initial->c_str());
+    }
+  }
+
+  if (!folders && !filters.empty()) {
+    GtkFileFilter* filter = gtk_file_filter_new();
+    std::string name;
+
+    for (const auto& pattern : filters) {
+      gtk_file_filter_add_pattern(filter, pattern.c_str());
+      name += name.empty() ? pattern : ", " + pattern;
+    }
+
+    gtk_file_filter_set_name(filter, name.c_str());
+    gtk_file_chooser_add_filter(chooser, filter);
+  }
+
+  auto* request = new saucer_pick_request_ext{dialog, std::move(done)};
+  g_signal_connect(dialog, "response", G_CALLBACK(OnPickResponse), request);
+  gtk_native_dialog_show(GTK_NATIVE_DIALOG(dialog));
+
+  return request;
+}
+
+void saucer_desktop_pick_cancel_ext(saucer_pick_request_ext* request) {
+  // Hiding does not emit "response", so the request is finished here
+  FinishPick(request, std::nullopt);
+}
+
+// ============================================================================
+// Native-owned main loop (GLib hosts libuv)
+// ============================================================================
+
+namespace {
+
+// GSource that polls libuv's backend fd and uses libuv's next timer as its timeout. Dispatch only
+// flags that libuv has work due: GLib runs inside uv_run's check phase, so calling uv_run from here
+// would re-enter it. saucer_loop_wait_uv_ext returns instead and uv_run runs the callbacks itself
+struct UvSource {
+  GSource source;
+  uv_loop_t* loop;
+  gpointer tag;
+  bool ready;
+};
+
+GSource* uv_source = nullptr;
+
+int UvTimeout(uv_loop_t* loop) {
+  // With nothing referenced libuv reports 0 ("exit now"); block on the fd instead of spinning
+  return uv_loop_alive(loop) ? uv_backend_timeout(loop) : -1;
+}
+
+gboolean UvSourcePrepare(GSource* source, gint* timeout) {
+  auto* self = reinterpret_cast<UvSource*>(source);
+  uv_update_time(self->loop);
+  *timeout = UvTimeout(self->loop);
+  return *timeout == 0;
+}
+
+gboolean UvSourceCheck(GSource* source) {
+  auto* self = reinterpret_cast<UvSource*>(source);
+  if (g_source_query_unix_fd(source, self->tag) & G_IO_IN) {
+    return TRUE;
+  }
+  uv_update_time(self->loop);
+  return UvTimeout(self->loop) == 0;
+}
+
+gboolean UvSourceDispatch(GSource* source, GSourceFunc, gpointer) {
+  reinterpret_cast<UvSource*>(source)->ready = true;
+  return G_SOURCE_CONTINUE;
+}
+
+GSourceFuncs uv_source_funcs = {
+  UvSourcePrepare,
+  UvSourceCheck,
+  UvSourceDispatch,
+  nullptr,
+  nullptr,
+  nullptr,
+};
+
+} // namespace
+
+bool saucer_loop_attach_uv_ext(uv_loop_s* loop) {
+  if (uv_source) {
+    return true;
+  }
+
+  GSource* source = g_source_new(&uv_source_funcs, sizeof(UvSource));
+  auto* self = reinterpret_cast<UvSource*>(source);
+  self->loop = loop;
+  self->ready = false;
+  self->tag = g_source_add_unix_fd(source, uv_backend_fd(loop), static_cast<GIOCondition>(G_IO_IN));
+
+  g_source_set_priority(source, G_PRIORITY_DEFAULT);
+  g_source_set_name(source, "saucer-nodejs libuv");
+  g_source_attach(source, g_main_context_default());
+
+  uv_source = source;
+  return true;
+}
+
+void saucer_loop_wait_uv_ext(const bool* stop) {
+  if (!uv_source) {
+    return;
+  }
+
+  auto* self = reinterpret_cast<UvSource*>(uv_source);
+  self->ready = false;
+
+  // Handlers dispatched from here (saucer events calling into JS) may set *stop
+  while (!self->ready && !*stop) {
+    g_main_context_iteration(g_main_context_default(), TRUE);
+  }
+}
+
+void saucer_loop_detach_uv_ext() {
+  if (!uv_source) {
+    return;
+  }
+
+  g_source_destroy(uv_source);
+  g_source_unref(uv_source);
+  uv_source = nullptr;
+}
+
+bool saucer_loop_pending_ext() {
+  return g_main_context_pending(g_main_context_default());
 }
 
 #endif // __linux__
@@ -19,6 +19,8 @@ Napi::Object Clipboard::Init(Napi::Env env, Napi::Object exports) {
   Napi::Object clipboard = Napi::Object::New(env);
   
   clipboard.Set("readText", Napi::Function::New(env, &Clipboard::ReadText));
+  clipboard.Set("readTextAsync", Napi::Function::New(env, &Clipboard::ReadTextAsync));
+  clipboard.Set("readImageAsync", Napi::Function::New(env, &Clipboard::ReadImageAsync));
   clipboard.Set("writeText", Napi::Function::New(env, &Clipboard::WriteText));
   clipboard.Set("hasText", Napi::Function::New(env, &Clipboard::HasText));
   clipboard.Set("hasImage", Napi::Function::New(env, &Clipboard::HasImage));
@@ -120,6 +122,31 @@ void Clipboard::Clear(const Napi::CallbackInfo& info) {
   }
 }
 
+// The system clipboard answers synchronously here, so the async variants resolve immediately
+Napi::Value Clipboard::ReadTextAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  auto deferred = Napi::Promise::Deferred::New(env);
+  deferred.Resolve(ReadText(info));
+  return deferred.Promise();
+}
+
+Napi::Value Clipboard::ReadImageAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  auto deferred = Napi::Promise::Deferred::New(env);
+
+  if (info.Length() > 0 && info[0].IsObject()) {
+    Napi::Object opts = info[0].As<Napi::Object>();
+    if (opts.Has("format") && opts.Get("format").IsString() &&
+        opts.Get("format").As<Napi::String>().Utf8Value() == "rgba") {
+      deferred.Reject(Napi::Error::New(env, "Raw RGBA clipboard images are only supported on Linux").Value());
+      return deferred.Promise();
+    }
+  }
+
+  deferred.Resolve(ReadImage(info));
+  return deferred.Promise();
+}
+
 // ============================================================================
 // Notification Implementation (Windows)
 // ============================================================================
@@ -154,7 +181,18 @@ Notification::Notification(const Napi::CallbackInfo& info)
 
 Notification::~Notification() {}
 
-void Notification::Show(const Napi::CallbackInfo& info) {
+Napi::Value Notification::Show(const Napi::CallbackInfo& info) {
+  // Optional overrides so repeated show() calls can update the content
+  if (info.Length() > 0 && info[0].IsObject()) {
+    Napi::Object opts = info[0].As<Napi::Object>();
+    if (opts.Has("title") && opts.Get("title").IsString()) {
+      title_ = opts.Get("title").As<Napi::String>().Utf8Value();
+    }
+    if (opts.Has("body") && opts.Get("body").IsString()) {
+      body_ = opts.Get("body").As<Napi::String>().Utf8Value();
+    }
+  }
+  
   // Simple balloon notification using Shell_NotifyIcon
   // For full Windows 10/11 toast notifications, would need WinRT APIs
   
@@ -173,6 +211,12 @@ void Notification::Show(const Napi::CallbackInfo& info) {
     min(bodySize, static_cast<int>(sizeof(nid.szInfo) / sizeof(wchar_t))));
   
   Shell_NotifyIconW(NIM_MODIFY, &nid);
+
+  // No server-side id is available on this platform
+  Napi::Env env = info.Env();
+  auto deferred = Napi::Promise::Deferred::New(env);
+  deferred.Resolve(env.Null());
+  return deferred.Promise();
 }
 
 Napi::Value Notification::IsSupported(const Napi::CallbackInfo& info) {
@@ -279,6 +323,16 @@ void saucer_window_set_position_ext(saucer_handle* handle, int x, int y) {
   // TODO: Use SetWindowPos
 }
 
+bool saucer_window_position_supported_ext(saucer_handle* handle) {
+  // TODO: true once the position extensions are implemented
+  return false;
+}
+
+bool saucer_window_set_geometry_ext(saucer_handle* handle, const saucer_window_geometry_ext& geometry) {
+  // TODO: Combine into one SetWindowPos call
+  return false;
+}
+
 bool saucer_window_fullscreen_ext(saucer_handle* handle) {
   // TODO: Check window style
   return false;
@@ -297,4 +351,34 @@ void saucer_webview_set_zoom_ext(saucer_handle* handle, double level) {
   // TODO: Use ICoreWebView2Controller::put_ZoomFactor
 }
 
+bool saucer_webview_begin_context_ext(saucer_preferences* prefs, std::string* error) {
+  // Groups share a user data folder and the process limit becomes a browser flag, both in saucer_new;
+  // WebView2 has no cache model setting
+  return true;
+}
+
+void saucer_webview_end_context_ext() {}
+
+saucer_pick_request_ext* saucer_desktop_pick_async_ext(saucer_picker_kind_ext kind, const std::optional<std::string>& initial,
+                                                       const std::vector<std::string>& filters, saucer_pick_done_ext done) {
+  // TODO: IFileOpenDialog::Show blocks; needs a modeless dialog thread
+  return nullptr;
+}
+
+void saucer_desktop_pick_cancel_ext(saucer_pick_request_ext* request) {}
+
+bool saucer_loop_attach_uv_ext(uv_loop_s* loop) {
+  // The Win32 message loop has no fd to poll libuv with; run() keeps the libuv-driven integration
+  return false;
+}
+
+void saucer_loop_wait_uv_ext(const bool* stop) {}
+
+void saucer_loop_detach_uv_ext() {}
+
+bool saucer_loop_pending_ext() {
+  MSG msg;
+  return PeekMessageW(&msg, nullptr, 0, 0, PM_NOREMOVE) != 0;
+}
+
 #endif // _WIN32
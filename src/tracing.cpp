@@ -0,0 +1,229 @@
+#include "tracing.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace saucer_nodejs {
+namespace tracing {
+
+std::atomic<bool> enabled{false};
+
+uint64_t Now() {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+#if SAUCER_NODEJS_TRACING
+
+namespace {
+
+struct Event {
+  const char* category;
+  char name[48];
+  uint64_t start;
+  uint64_t end;
+};
+
+// Single-producer ring: only the owning thread writes, the exporter reads after
+// tracing is disabled and `writing` has dropped, so the hot path takes no lock.
+struct Ring {
+  Ring(size_t capacity, uint32_t tid, uint64_t generation)
+    : events(capacity), tid(tid), generation(generation) {}
+
+  std::vector<Event> events;
+  std::atomic<uint64_t> written{0};
+  std::atomic<bool> writing{false};
+  uint32_t tid;
+  uint64_t generation;
+};
+
+std::mutex registry_mutex;
+std::vector<std::shared_ptr<Ring>> rings;
+uint64_t generation = 0;
+std::atomic<uint64_t> current_generation{0};
+size_t capacity = 16384;
+uint64_t trace_start = 0;
+uint32_t main_tid = 0;
+
+std::atomic<uint32_t> next_tid{1};
+thread_local uint32_t thread_tid = next_tid.fetch_add(1, std::memory_order_relaxed);
+thread_local std::shared_ptr<Ring> thread_ring;
+
+Ring* LocalRing() {
+  if (thread_ring && thread_ring->generation == current_generation.load(std::memory_order_acquire)) {
+    return thread_ring.get();
+  }
+
+  // First span on this thread since Start(): register a fresh ring (once per thread per trace)
+  std::scoped_lock lock(registry_mutex);
+  thread_ring = std::make_shared<Ring>(capacity, thread_tid, generation);
+  rings.push_back(thread_ring);
+  return thread_ring.get();
+}
+
+void WaitForWriters(const std::vector<std::shared_ptr<Ring>>& snapshot) {
+  for (const auto& ring : snapshot) {
+    while (ring->writing.load(std::memory_order_seq_cst)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void AppendEscaped(std::string& out, std::string_view value) {
+  for (char c : value) {
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\r': out += "\\r"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned char>(c));
+          out += buffer;
+        } else {
+          out += c;
+        }
+    }
+  }
+}
+
+void AppendMicros(std::string& out, uint64_t nanos) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(nanos) / 1000.0);
+  out += buffer;
+}
+
+} // namespace
+
+void Record(const char* category, std::string_view name, uint64_t start) {
+  uint64_t end = Now();
+  Ring* ring = LocalRing();
+
+  // Pairs with the seq_cst store/load in Stop(): either Stop() sees `writing`, or we see `enabled == false`
+  ring->writing.store(true, std::memory_order_seq_cst);
+
+  if (enabled.load(std::memory_order_seq_cst)) {
+    uint64_t index = ring->written.load(std::memory_order_relaxed);
+    Event& event = ring->events[index % ring->events.size()];
+
+    size_t length = std::min(name.size(), sizeof(event.name) - 1);
+    std::memcpy(event.name, name.data(), length);
+    event.name[length] = '\0';
+    event.category = category;
+    event.start = start;
+    event.end = end;
+
+    ring->written.store(index + 1, std::memory_order_release);
+  }
+
+  ring->writing.store(false, std::memory_order_release);
+}
+
+bool Start(size_t events_per_thread) {
+  if (enabled.exchange(false, std::memory_order_seq_cst)) {
+    std::vector<std::shared_ptr<Ring>> snapshot;
+    {
+      std::scoped_lock lock(registry_mutex);
+      snapshot = rings;
+    }
+    WaitForWriters(snapshot);
+  }
+
+  {
+    std::scoped_lock lock(registry_mutex);
+    rings.clear();
+    capacity = std::max<size_t>(events_per_thread, 64);
+    trace_start = Now();
+    main_tid = thread_tid;
+    current_generation.store(++generation, std::memory_order_release);
+  }
+
+  enabled.store(true, std::memory_order_seq_cst);
+  return true;
+}
+
+std::string Stop() {
+  enabled.store(false, std::memory_order_seq_cst);
+
+  std::vector<std::shared_ptr<Ring>> snapshot;
+  uint64_t origin = 0;
+  uint32_t main = 0;
+  {
+    std::scoped_lock lock(registry_mutex);
+    snapshot = rings;
+    origin = trace_start;
+    main = main_tid;
+  }
+
+  WaitForWriters(snapshot);
+
+  std::string out;
+  out.reserve(256 + snapshot.size() * 128);
+  out += "{\"traceEvents\":[";
+
+  bool first = true;
+  uint64_t dropped = 0;
+
+  for (const auto& ring : snapshot) {
+    uint64_t written = ring->written.load(std::memory_order_acquire);
+    uint64_t size = ring->events.size();
+    uint64_t begin = written > size ? written - size : 0;
+    dropped += begin;
+
+    if (!first) out += ',';
+    first = false;
+
+    out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+    out += std::to_string(ring->tid);
+    out += ",\"args\":{\"name\":\"";
+    out += ring->tid == main ? "main" : "thread-" + std::to_string(ring->tid);
+    out += "\"}}";
+
+    for (uint64_t i = begin; i < written; i++) {
+      const Event& event = ring->events[i % size];
+      uint64_t start = event.start > origin ? event.start - origin : 0;
+
+      out += ",{\"name\":\"";
+      AppendEscaped(out, event.name);
+      out += "\",\"cat\":\"";
+      out += event.category;
+      out += "\",\"ph\":\"X\",\"ts\":";
+      AppendMicros(out, start);
+      out += ",\"dur\":";
+      AppendMicros(out, event.end - event.start);
+      out += ",\"pid\":1,\"tid\":";
+      out += std::to_string(ring->tid);
+      out += '}';
+    }
+  }
+
+  out += "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":";
+  out += std::to_string(dropped);
+  out += "}}";
+  return out;
+}
+
+#else
+
+void Record(const char*, std::string_view, uint64_t) {}
+
+bool Start(size_t) {
+  return false;
+}
+
+std::string Stop() {
+  return "{\"traceEvents\":[],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":0}}";
+}
+
+#endif
+
+} // namespace tracing
+} // namespace saucer_nodejs
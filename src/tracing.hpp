@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Compile-time switch for the native tracer. With 0 every hook folds to a constant
+// false check; with 1 a disabled tracer costs one relaxed atomic load per hook.
+#ifndef SAUCER_NODEJS_TRACING
+#define SAUCER_NODEJS_TRACING 1
+#endif
+
+namespace saucer_nodejs {
+namespace tracing {
+
+// ============================================================================
+// Native tracer - spans recorded into per-thread ring buffers, exported as
+// Chrome trace-event JSON (loadable in chrome://tracing and Perfetto)
+// ============================================================================
+
+extern std::atomic<bool> enabled;
+
+inline bool Enabled() {
+#if SAUCER_NODEJS_TRACING
+  return enabled.load(std::memory_order_relaxed);
+#else
+  return false;
+#endif
+}
+
+// Monotonic clock in nanoseconds
+uint64_t Now();
+
+// Start timestamp for a span, or 0 when tracing is off (cheap to carry in task payloads)
+inline uint64_t Timestamp() {
+  return Enabled() ? Now() : 0;
+}
+
+// Append the span [start, now) to the calling thread's ring buffer
+void Record(const char* category, std::string_view name, uint64_t start);
+
+// Record a span that began at `start` (as returned by Timestamp()) and ends now
+inline void Span(const char* category, std::string_view name, uint64_t start) {
+  if (start != 0 && Enabled()) {
+    Record(category, name, start);
+  }
+}
+
+// Begin a new trace; each thread keeps its latest `events_per_thread` spans
+bool Start(size_t events_per_thread);
+
+// Stop tracing and return everything recorded as Chrome trace-event JSON
+std::string Stop();
+
+// Records the lifetime of the enclosing scope
+class Scope {
+public:
+  Scope(const char* category, const char* name) : category_(category), name_(name), start_(Timestamp()) {}
+  ~Scope() { Span(category_, name_, start_); }
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+private:
+  const char* category_;
+  const char* name_;
+  uint64_t start_;
+};
+
+} // namespace tracing
+} // namespace saucer_nodejs
+
+#define SAUCER_NODEJS_TRACE_CONCAT_IMPL(a, b) a##b
+#define SAUCER_NODEJS_TRACE_CONCAT(a, b) SAUCER_NODEJS_TRACE_CONCAT_IMPL(a, b)
+
+#if SAUCER_NODEJS_TRACING
+#define SAUCER_NODEJS_TRACE_SCOPE(category, name) \
+  ::saucer_nodejs::tracing::Scope SAUCER_NODEJS_TRACE_CONCAT(saucer_trace_scope_, __LINE__)(category, name)
+#else
+#define SAUCER_NODEJS_TRACE_SCOPE(category, name) ((void)0)
+#endif
@@ -0,0 +1,126 @@
+#include "watchdog.hpp"
+
+#include "tracing.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace saucer_nodejs {
+namespace watchdog {
+
+std::atomic<uint64_t> last_beat{0};
+
+namespace {
+
+std::mutex mutex;
+std::condition_variable wake;
+std::thread worker;
+
+bool running = false;
+bool suspended = false;
+uint64_t threshold = 0;
+Handler begin_handler;
+Handler end_handler;
+
+uint64_t next_id = 0;
+std::atomic<uint64_t> active_id{0};
+Stall current;
+
+void Run() {
+  std::unique_lock lock(mutex);
+
+  while (running) {
+    // Poll at a quarter of the threshold so a stall is reported within 1.25x of it
+    auto period = std::chrono::nanoseconds(std::max<uint64_t>(threshold / 4, 1'000'000));
+    wake.wait_for(lock, period);
+
+    if (!running || suspended) {
+      continue;
+    }
+
+    uint64_t beat = last_beat.load(std::memory_order_relaxed);
+
+    if (active_id.load(std::memory_order_relaxed) == 0) {
+      if (tracing::Now() - beat <= threshold) {
+        continue;
+      }
+
+      current = Stall{ ++next_id, beat, 0 };
+      active_id.store(current.id, std::memory_order_relaxed);
+
+      Stall stall = current;
+      Handler handler = begin_handler;
+      lock.unlock();
+      if (handler) handler(stall);
+      lock.lock();
+    } else if (beat != current.started) {
+      current.duration = beat - current.started;
+      active_id.store(0, std::memory_order_relaxed);
+
+      Stall stall = current;
+      Handler handler = end_handler;
+      lock.unlock();
+      if (handler) handler(stall);
+      lock.lock();
+    }
+  }
+}
+
+} // namespace
+
+void Start(uint64_t threshold_ns, Handler on_begin, Handler on_end) {
+  Stop();
+
+  {
+    std::scoped_lock lock(mutex);
+    running = true;
+    threshold = threshold_ns;
+    begin_handler = std::move(on_begin);
+    end_handler = std::move(on_end);
+    active_id.store(0, std::memory_order_relaxed);
+    last_beat.store(tracing::Now(), std::memory_order_relaxed);
+  }
+
+  worker = std::thread(Run);
+}
+
+void Stop() {
+  {
+    std::scoped_lock lock(mutex);
+    if (!running) {
+      return;
+    }
+    running = false;
+  }
+
+  wake.notify_all();
+  if (worker.joinable()) {
+    worker.join();
+  }
+
+  std::scoped_lock lock(mutex);
+  begin_handler = nullptr;
+  end_handler = nullptr;
+  active_id.store(0, std::memory_order_relaxed);
+}
+
+void Suspend(bool value) {
+  std::scoped_lock lock(mutex);
+  suspended = value;
+
+  // Resuming must not report the suspended period as a stall
+  last_beat.store(tracing::Now(), std::memory_order_relaxed);
+  if (value) {
+    active_id.store(0, std::memory_order_relaxed);
+  }
+}
+
+bool Active(uint64_t id) {
+  return id != 0 && active_id.load(std::memory_order_relaxed) == id;
+}
+
+} // namespace watchdog
+} // namespace saucer_nodejs
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace saucer_nodejs {
+namespace watchdog {
+
+// ============================================================================
+// Stall watchdog - a native thread that notices when the loop hooks stop
+// calling saucer_application_run_once (the Node/UI thread is blocked)
+// ============================================================================
+
+struct Stall {
+  uint64_t id = 0;
+  uint64_t started = 0;   // steady clock ns of the last heartbeat before the stall
+  uint64_t duration = 0;  // ns, set once the loop beats again
+};
+
+// Called on the watchdog thread
+using Handler = std::function<void(const Stall&)>;
+
+extern std::atomic<uint64_t> last_beat;
+
+// Heartbeat from the loop hooks; `now` is a steady clock timestamp in ns
+inline void Beat(uint64_t now) {
+  last_beat.store(now, std::memory_order_relaxed);
+}
+
+// Start (or reconfigure) the watchdog; `on_begin` fires once a stall passes the threshold,
+// `on_end` when the loop beats again
+void Start(uint64_t threshold_ns, Handler on_begin, Handler on_end);
+
+void Stop();
+
+// Suspend while something other than the hooks owns the loop (native loop mode)
+void Suspend(bool suspended);
+
+// Whether stall `id` is still in progress
+bool Active(uint64_t id);
+
+} // namespace watchdog
+} // namespace saucer_nodejs